@@ -0,0 +1,80 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#  Thermal plasma with identical dense and sparse particle binning diagnostics
+# ----------------------------------------------------------------------------------------
+
+import math
+
+Main(
+    geometry = "2Dcartesian",
+    
+    interpolation_order = 2,
+    
+    cell_length = [0.1, 0.1],
+    grid_length  = [6.4, 6.4],
+    
+    number_of_patches = [ 4, 4 ],
+    
+    timestep = 0.05,
+    simulation_time = 5.,
+    
+    EM_boundary_conditions = [
+        ["periodic"],
+        ["periodic"],
+    ],
+)
+
+Species(
+    name = "electron",
+    position_initialization = "regular",
+    momentum_initialization = "maxwell-juettner",
+    particles_per_cell = 9,
+    mass = 1.0,
+    charge = -1.0,
+    number_density = 1.,
+    temperature = [0.01],
+    boundary_conditions = [
+        ["periodic"],
+        ["periodic"],
+    ],
+)
+
+Species(
+    name = "ion",
+    position_initialization = "regular",
+    momentum_initialization = "cold",
+    particles_per_cell = 9,
+    mass = 1836.0,
+    charge = 1.0,
+    number_density = 1.,
+    boundary_conditions = [
+        ["periodic"],
+        ["periodic"],
+    ],
+)
+
+# Same diagnostics, dense then sparse
+for sparse in [False, True]:
+    DiagParticleBinning(
+        deposited_quantity = "weight",
+        every = 20,
+        time_average = 2,
+        species = ["electron"],
+        axes = [
+            ["x", 0., 6.4, 16],
+            ["px", -0.4, 0.4, 40],
+            ["py", "auto", "auto", 40],
+        ],
+        sparse = sparse,
+    )
+    DiagParticleBinning(
+        deposited_quantity = "weight_ekin",
+        every = 20,
+        species = ["electron", "ion"],
+        axes = [
+            ["ekin", 1e-4, 0.1, 50, "logscale"],
+        ],
+        sparse = sparse,
+    )
+
+DiagScalar(every = 20)
@@ -0,0 +1,62 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#  Laser in a plasma slab with field ghost cells exchanged every 3 timesteps
+# ----------------------------------------------------------------------------------------
+
+import math
+
+l0 = 2.*math.pi
+
+Main(
+    geometry = "2Dcartesian",
+    
+    interpolation_order = 2,
+    
+    cell_length = [l0/20., l0/20.],
+    grid_length  = [8.*l0, 4.*l0],
+    
+    number_of_patches = [ 8, 4 ],
+    
+    timestep = 0.95*l0/20./math.sqrt(2.),
+    simulation_time = 6.*l0,
+    
+    exchange_fields_each = 3,
+    
+    EM_boundary_conditions = [
+        ["silver-muller"],
+        ["periodic"],
+    ],
+)
+
+LaserGaussian2D(
+    box_side = "xmin",
+    a0 = 2.,
+    omega = 1.,
+    focus = [0., 2.*l0],
+    waist = 0.4*l0,
+    time_envelope = tgaussian(center=2.*l0, fwhm=2.*l0)
+)
+
+for name, mass, charge in [["electron", 1., -1.], ["ion", 1836., 1.]]:
+    Species(
+        name = name,
+        position_initialization = "regular",
+        momentum_initialization = "cold",
+        particles_per_cell = 4,
+        mass = mass,
+        charge = charge,
+        number_density = trapezoidal(0.5, xvacuum=4.*l0, xplateau=3.*l0),
+        boundary_conditions = [
+            ["remove", "remove"],
+            ["periodic", "periodic"],
+        ],
+    )
+
+DiagScalar(
+    every = 10,
+)
+
+DiagFields(
+    every = 150,
+    fields = ["Ey", "Rho_electron"]
+)
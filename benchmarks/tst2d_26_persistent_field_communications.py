@@ -0,0 +1,80 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#  Laser in a plasma slab with persistent MPI requests for the fields,
+#  set up again when patches move (moving window and load balancing)
+# ----------------------------------------------------------------------------------------
+
+import math
+
+l0 = 2.*math.pi
+
+Main(
+    geometry = "2Dcartesian",
+    
+    interpolation_order = 2,
+    
+    cell_length = [l0/20., l0/20.],
+    grid_length  = [8.*l0, 4.*l0],
+    
+    number_of_patches = [ 8, 4 ],
+    
+    timestep = 0.95*l0/20./math.sqrt(2.),
+    simulation_time = 8.*l0,
+    
+    persistent_field_communications = True,
+    
+    EM_boundary_conditions = [
+        ["silver-muller"],
+        ["periodic"],
+    ],
+)
+
+MovingWindow(
+    time_start = 4.*l0,
+    velocity_x = 1.
+)
+
+LoadBalancing(
+    initial_balance = False,
+    every = 20,
+    cell_load = 1.,
+    frozen_particle_load = 0.1
+)
+
+LaserGaussian2D(
+    box_side = "xmin",
+    a0 = 2.,
+    omega = 1.,
+    focus = [0., 2.*l0],
+    waist = 0.4*l0,
+    time_envelope = tgaussian(center=2.*l0, fwhm=2.*l0)
+)
+
+for name, mass, charge in [["electron", 1., -1.], ["ion", 1836., 1.]]:
+    Species(
+        name = name,
+        position_initialization = "regular",
+        momentum_initialization = "cold",
+        particles_per_cell = 4,
+        mass = mass,
+        charge = charge,
+        number_density = trapezoidal(0.5, xvacuum=4.*l0, xplateau=8.*l0),
+        boundary_conditions = [
+            ["remove", "remove"],
+            ["periodic", "periodic"],
+        ],
+    )
+
+DiagScalar(
+    every = 10,
+)
+
+DiagParticleBinning(
+    deposited_quantity = "weight_charge",
+    every = 100,
+    species = ["electron"],
+    axes = [
+        ["moving_x", 0., 8.*l0, 80],
+        ["y", 0., 4.*l0, 40]
+    ]
+)
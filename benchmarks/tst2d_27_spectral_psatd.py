@@ -0,0 +1,70 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#  Wave packet in a periodic thermal plasma, with the native spectral (PSATD) solver
+#  and a timestep above the CFL limit of the Yee solver
+# ----------------------------------------------------------------------------------------
+
+import math
+
+l0 = 2.*math.pi
+dx = l0/16.
+Lx = 4.*l0
+Ly = 2.*l0
+
+Main(
+    geometry = "2Dcartesian",
+
+    interpolation_order = 2,
+    maxwell_solver = "spectral",
+    spectral_solver_order = [8, 8],
+
+    cell_length = [dx, dx],
+    grid_length  = [Lx, Ly],
+
+    number_of_patches = [ 4, 2 ],
+
+    timestep = 1.2*dx/math.sqrt(2.),
+    simulation_time = 3.*l0,
+
+    EM_boundary_conditions = [
+        ["periodic"],
+        ["periodic"],
+    ],
+
+    print_every = 10,
+)
+
+MultipleDecomposition(
+    region_ghost_cells = 6
+)
+
+# Wave packet: splits into two counter-propagating pulses
+ExternalField(
+    field = "Ez",
+    profile = lambda x, y: 0.1*math.sin(x)*math.exp(-((x-Lx/2.)/(0.5*l0))**2)
+)
+
+for name, mass, charge in [["electron", 1., -1.], ["ion", 1836., 1.]]:
+    Species(
+        name = name,
+        position_initialization = "regular",
+        momentum_initialization = "mj",
+        particles_per_cell = 4,
+        mass = mass,
+        charge = charge,
+        number_density = 0.05,
+        temperature = [0.01],
+        boundary_conditions = [
+            ["periodic", "periodic"],
+            ["periodic", "periodic"],
+        ],
+    )
+
+DiagScalar(
+    every = 5,
+)
+
+DiagFields(
+    every = 50,
+    fields = ['Ex', 'Ey', 'Ez', 'By', 'Rho_electron']
+)
@@ -0,0 +1,63 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#  Hot thermal plasma with particles exchanged directly with all neighbor patches
+# ----------------------------------------------------------------------------------------
+
+import math
+
+l0 = 2.*math.pi
+
+Main(
+    geometry = "3Dcartesian",
+    
+    interpolation_order = 2,
+    
+    cell_length = [l0/10.]*3,
+    grid_length  = [4.*l0, 4.*l0, 2.*l0],
+    
+    number_of_patches = [ 4, 4, 2 ],
+    
+    timestep = 0.9*l0/10./math.sqrt(3.),
+    simulation_time = 2.*l0,
+    
+    particle_exchange = "all_neighbors",
+    
+    EM_boundary_conditions = [
+        ["periodic"],
+        ["periodic"],
+        ["silver-muller"],
+    ],
+    
+    print_every = 10,
+)
+
+for name, mass, charge in [["electron", 1., -1.], ["ion", 100., 1.]]:
+    Species(
+        name = name,
+        position_initialization = "random",
+        momentum_initialization = "maxwell-juettner",
+        temperature = [0.3],
+        particles_per_cell = 2,
+        mass = mass,
+        charge = charge,
+        number_density = 0.5,
+        boundary_conditions = [
+            ["periodic"],
+            ["periodic"],
+            ["remove"],
+        ],
+    )
+
+DiagScalar(
+    every = 5,
+)
+
+DiagParticleBinning(
+    deposited_quantity = "weight",
+    every = 20,
+    species = ["electron"],
+    axes = [
+        ["x", 0., 4.*l0, 20],
+        ["y", 0., 4.*l0, 20],
+    ]
+)
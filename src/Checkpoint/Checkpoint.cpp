@@ -52,7 +52,8 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
     keep_n_dumps( 2 ),
     keep_n_dumps_max( 10000 ),
     dump_deflate( 0 ),
-    file_grouping( 0 )
+    file_grouping( 0 ),
+    requested_file_grouping( 0 )
 {
 
     if( PyTools::nComponents( "Checkpoints" ) > 0 ) {
@@ -82,6 +83,7 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
         PyTools::extract( "dump_deflate", dump_deflate, "Checkpoints"  );
 
         PyTools::extract( "file_grouping", file_grouping, "Checkpoints"  );
+        requested_file_grouping = file_grouping;
         if( file_grouping > 0 ) {
             if( file_grouping > ( unsigned int )( smpi->getSize() ) ) {
                 file_grouping = smpi->getSize();
@@ -599,8 +601,27 @@ void Checkpoint::readPatchDistribution( SmileiMPI *smpi, SimWindow *simWin )
         WARNING( "                while running version is " << string( __VERSION ) );
     }
 
-    vector<int> patch_count( smpi->getSize() );
-    f.vect( "patch_count", patch_count );
+    vector<int> patch_count;
+    f.vect( "patch_count", patch_count, true );
+    dump_patch_count_ = patch_count;
+    
+    // If the dump was written by a different number of processes, split the patches evenly
+    // along the Hilbert curve: each process reads its range from the files of the previous run,
+    // then the load balancing adjusts the distribution
+    if( patch_count.size() != ( size_t )smpi->getSize() ) {
+        int tot_number_of_patches = 0;
+        for( unsigned int rk=0; rk<patch_count.size(); rk++ ) {
+            tot_number_of_patches += patch_count[rk];
+        }
+        if( tot_number_of_patches < smpi->getSize() ) {
+            ERROR( "Cannot restart " << tot_number_of_patches << " patches on " << smpi->getSize() << " MPI processes" );
+        }
+        MESSAGE( 1, "Restarting on " << smpi->getSize() << " MPI processes a dump written by " << patch_count.size() );
+        patch_count.resize( smpi->getSize() );
+        for( int rk=0; rk<smpi->getSize(); rk++ ) {
+            patch_count[rk] = tot_number_of_patches / smpi->getSize() + ( rk < tot_number_of_patches % smpi->getSize() ? 1 : 0 );
+        }
+    }
     smpi->patch_count = patch_count;
 
     smpi->patch_refHindexes.resize( smpi->patch_count.size(), 0 );
@@ -628,17 +649,40 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
         f.attr( "Energy_time_zero",  scalars->Energy_time_zero );
         f.attr( "EnergyUsedForNorm", scalars->EnergyUsedForNorm );
     }
-    // Poynting scalars
+    // Number of processes which wrote the dump
+    unsigned int n_writers = dump_patch_count_.size();
+    bool redistribute = n_writers != ( unsigned int )smpi->getSize();
+    if( redistribute && params.multiple_decomposition ) {
+        ERROR( "A dump with MultipleDecomposition must be restarted with the same number of MPI processes" );
+    }
+    
+    // Poynting scalars (sums over the patches of each process)
     unsigned int k=0;
     for( unsigned int j=0; j<2; j++ ) { //directions (xmin/xmax, ymin/ymax, zmin/zmax)
         for( unsigned int i=0; i<params.nDim_field; i++ ) { //axis 0=x, 1=y, 2=z
             string poy_name = Tools::merge( "Poy", Tools::xyz[i], j==0?"min":"max" );
-            if( f.hasAttr( poy_name ) ) {
+            if( ! redistribute && f.hasAttr( poy_name ) ) {
                 f.attr( poy_name, vecPatches( 0 )->EMfields->poynting[j][i] );
             }
             k++;
         }
     }
+    if( redistribute ) {
+        // Each process gathers the sums of the writers with the same rank modulo the number of processes
+        for( unsigned int writer = smpi->getRank(); writer < n_writers; writer += smpi->getSize() ) {
+            H5Read fw( restartFileOfRank( writer ) );
+            for( unsigned int j=0; j<2; j++ ) {
+                for( unsigned int i=0; i<params.nDim_field; i++ ) {
+                    string poy_name = Tools::merge( "Poy", Tools::xyz[i], j==0?"min":"max" );
+                    if( fw.hasAttr( poy_name ) ) {
+                        double poy_val = 0.;
+                        fw.attr( poy_name, poy_val );
+                        vecPatches( 0 )->EMfields->poynting[j][i] += poy_val;
+                    }
+                }
+            }
+        }
+    }
 
     // Read the diags screen data
     if( smpi->isMaster() ) {
@@ -660,12 +704,33 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
     }
 
     // Read all the patch data
+    // When redistributing, the patches (sorted along the Hilbert curve) are read
+    // from the files of the processes which wrote them, opened one after the other
+    H5Read *writer_file = NULL;
+    unsigned int writer = 0;
+    unsigned int writer_end = n_writers > 0 ? dump_patch_count_[0] : 0;
     for( unsigned int ipatch=0 ; ipatch<vecPatches.size(); ipatch++ ) {
 
+        H5Read *fp = &f;
+        if( redistribute ) {
+            unsigned int hindex = vecPatches( ipatch )->Hindex();
+            bool changed = ( writer_file == NULL );
+            while( hindex >= writer_end && writer+1 < n_writers ) {
+                writer++;
+                writer_end += dump_patch_count_[writer];
+                changed = true;
+            }
+            if( changed ) {
+                delete writer_file;
+                writer_file = new H5Read( restartFileOfRank( writer ) );
+            }
+            fp = writer_file;
+        }
+
         ostringstream patch_name( "" );
         patch_name << setfill( '0' ) << setw( 6 ) << vecPatches( ipatch )->Hindex();
         string patchName = Tools::merge( "patch-", patch_name.str() );
-        H5Read g = f.group( patchName );
+        H5Read g = fp->group( patchName );
 
         restartPatch( vecPatches( ipatch ), params, g );
 
@@ -673,6 +738,7 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
         g.attr( "xorshift32_state", vecPatches( ipatch )->rand_->xorshift32_state );
 
     }
+    delete writer_file;
 
     if (params.multiple_decomposition) {
         ostringstream patch_name( "" );
@@ -687,7 +753,8 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
         if( DiagnosticTrack *track = dynamic_cast<DiagnosticTrack *>( vecPatches.localDiags[idiag] ) ) {
             ostringstream n( "" );
             n<< "latest_ID_" << track->species_name_;
-            if( f.hasAttr( n.str() ) ) {
+            // Processes which did not write the dump start a new range of IDs
+            if( smpi->getRank() < ( int )n_writers && f.hasAttr( n.str() ) ) {
                 f.attr( n.str(), track->latest_Id, H5T_NATIVE_UINT64 );
             } else {
                 track->IDs_done=false;
@@ -698,6 +765,31 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
 }
 
 
+// Name of the file written by a process of the previous run, for the same dump as restart_file
+std::string Checkpoint::restartFileOfRank( unsigned int rank )
+{
+    size_t pos = restart_file.rfind( PATH_SEPARATOR );
+    string dir = ( pos == string::npos ) ? "" : restart_file.substr( 0, pos+1 );
+    string name = ( pos == string::npos ) ? restart_file : restart_file.substr( pos+1 );
+    
+    // Replace the group directory, named as in dumpAll for the number of processes of the dump
+    unsigned int n_writers = dump_patch_count_.size();
+    if( requested_file_grouping > 0 && ! dir.empty() ) {
+        unsigned int grouping = min( requested_file_grouping, n_writers );
+        size_t pos_group = dir.rfind( PATH_SEPARATOR, dir.size()-2 );
+        dir = ( pos_group == string::npos ) ? "" : dir.substr( 0, pos_group+1 );
+        ostringstream group( "" );
+        group << setfill( '0' ) << setw( int( 1+log10( n_writers/grouping+1 ) ) ) << rank/grouping << PATH_SEPARATOR;
+        dir += group.str();
+    }
+    
+    // Replace the rank in "dump-<number>-<rank>.h5"
+    ostringstream file( "" );
+    file << name.substr( 0, 11 ) << setfill( '0' ) << setw( 10 ) << rank << ".h5";
+    return dir + file.str();
+}
+
+
 void Checkpoint::readRegionDistribution( Region &region )
 {
     int read_hindex( -1 );
@@ -129,10 +129,18 @@ private:
     
     //! group checkpoint files in subdirs of file_grouping files
     unsigned int file_grouping;
+    //! file_grouping requested in the namelist, before being limited to the number of processes
+    unsigned int requested_file_grouping;
     
     //! restart file
     std::string restart_file;
     
+    //! number of patches of each process which wrote the dump (may differ from the current number of processes)
+    std::vector<int> dump_patch_count_;
+    
+    //! name of the restart file written by a given process of the previous run
+    std::string restartFileOfRank( unsigned int rank );
+    
     //! dump PML in the checkpoint file 
     template <typename Tpml>
     void  dump_PML(Tpml embc, H5Write &g );
@@ -143,11 +143,77 @@ DiagnosticFields::DiagnosticFields( Params &params, SmileiMPI *smpi, VectorPatch
         }
     }
     
+    // Extract the coarsening factors
+    coarsening_.resize( params.nDim_field, 1 );
+    PyObject *coarsening = PyTools::extract_py( "coarsening", "DiagFields", ndiag );
+    unsigned int c;
+    if( PyTools::py2scalar( coarsening, c ) ) {
+        coarsening_.assign( params.nDim_field, c );
+    } else if( ! PyTools::py2vector( coarsening, coarsening_ ) || coarsening_.size() != params.nDim_field ) {
+        ERROR( "Diagnostic Fields #"<<ndiag<<" `coarsening` must be an integer or a list of "<<params.nDim_field<<" integers" );
+    }
+    Py_DECREF( coarsening );
+    coarsened_ = false;
+    for( unsigned int idim=0; idim<params.nDim_field; idim++ ) {
+        if( coarsening_[idim] < 1 || params.patch_size_[idim] % coarsening_[idim] != 0 ) {
+            ERROR( "Diagnostic Fields #"<<ndiag<<" `coarsening` axis #"<<idim<<" must divide the patch size ("<<params.patch_size_[idim]<<")" );
+        }
+        coarsened_ = coarsened_ || coarsening_[idim] > 1;
+    }
+    if( coarsened_ ) {
+        if( params.geometry != "2Dcartesian" && params.geometry != "3Dcartesian" ) {
+            ERROR( "Diagnostic Fields #"<<ndiag<<" `coarsening` is only available in 2Dcartesian and 3Dcartesian geometries" );
+        }
+        for( unsigned int idim=0; idim<params.nDim_field; idim++ ) {
+            if( subgrid_start_[idim] != 0 || subgrid_step_[idim] != 1 || subgrid_stop_[idim] <= params.global_size_[idim] ) {
+                ERROR( "Diagnostic Fields #"<<ndiag<<" cannot have both `coarsening` and `subgrid`" );
+            }
+        }
+    }
+    
+    // Extract the compression parameters
+    compression_ = 0;
+    PyTools::extract( "compression", compression_, "DiagFields", ndiag );
+    if( compression_ < 0 || compression_ > 9 ) {
+        ERROR( "Diagnostic Fields #"<<ndiag<<" `compression` must be between 0 and 9" );
+    }
+    compression_digits_ = -1;
+    if( PyTools::extractOrNone( "compression_digits", compression_digits_, "DiagFields", ndiag ) && compression_digits_ < 0 ) {
+        ERROR( "Diagnostic Fields #"<<ndiag<<" `compression_digits` must be positive" );
+    }
+    if( compression_ > 0 || compression_digits_ >= 0 ) {
+        if( params.geometry != "2Dcartesian" && params.geometry != "3Dcartesian" ) {
+            ERROR( "Diagnostic Fields #"<<ndiag<<" compression is only available in 2Dcartesian and 3Dcartesian geometries" );
+        }
+        if( compression_ > 0 && H5Zfilter_avail( H5Z_FILTER_DEFLATE ) <= 0 ) {
+            ERROR( "Diagnostic Fields #"<<ndiag<<" `compression` requires HDF5 with the deflate filter" );
+        }
+        if( compression_digits_ >= 0 && H5Zfilter_avail( H5Z_FILTER_SCALEOFFSET ) <= 0 ) {
+            ERROR( "Diagnostic Fields #"<<ndiag<<" `compression_digits` requires HDF5 with the scale-offset filter" );
+        }
+#if ! H5_VERSION_GE( 1, 10, 2 )
+        if( smpi->getSize() > 1 ) {
+            ERROR( "Diagnostic Fields #"<<ndiag<<" compression with several MPI processes requires HDF5 1.10.2 or newer" );
+        }
+#endif
+    }
+    
     // Some output
     ostringstream p( "" );
     p << "(time average = " << time_average << ")";
     MESSAGE( 1, "Diagnostic Fields #"<<ndiag<<" "<<( time_average>1?p.str():"" )<<" :" );
     MESSAGE( 2, ss.str() );
+    if( coarsened_ ) {
+        ostringstream c( "" );
+        for( unsigned int idim=0; idim<params.nDim_field; idim++ ) {
+            c << ( idim>0?" x ":"" ) << coarsening_[idim];
+        }
+        MESSAGE( 2, "Averaged over blocks of " << c.str() << " cells" );
+    }
+    if( compression_ > 0 || compression_digits_ >= 0 ) {
+        MESSAGE( 2, "Compression: deflate level " << compression_
+                 << ( compression_digits_ >= 0 ? ", "+to_string( compression_digits_ )+" decimal digits kept" : ", lossless" ) );
+    }
     
     // Create new fields in each patch, for time-average storage
     if( ! smpi->test_mode ) {
@@ -227,7 +293,7 @@ void DiagnosticFields::openFile( Params &, SmileiMPI *smpi )
     }
     
     // Create file
-    file_ = new H5Write( filename, &smpi->world() );
+    file_ = new H5Write( filename, &smpi->world(), true, smpi->diagnosticsIOInfo() );
     
     file_->attr( "name", diag_name_ );
     
@@ -341,7 +407,7 @@ void DiagnosticFields::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
             }
             bool ends_with_m = 0 == fields_names[ifield].compare( fields_names[ifield].length()-2, 2, "_m" );
             double stagger_t = ends_with_m ? vecPatches( 0 )->EMfields->timestep*0.5 : 0.;
-            openPMD_->writeFieldAttributes( dset, subgrid_start_, subgrid_step_ );
+            openPMD_->writeFieldAttributes( dset, subgrid_start_, subgrid_step_, coarsening_ );
             openPMD_->writeRecordAttributes( dset, field_type[ifield], stagger_t );
             openPMD_->writeFieldRecordAttributes( dset, stagger );
             openPMD_->writeComponentAttributes( dset, field_type[ifield] );
@@ -439,6 +505,73 @@ void DiagnosticFields::findSubgridIntersection(
     }
 }
 
+// Finds the zone of the file written by a patch along one dimension,
+// and the index in the patch grid of its first point
+void DiagnosticFields::findPatchIntersection(
+    hsize_t idim,
+    unsigned int patch_coordinate,
+    hsize_t &offset_in_file,
+    hsize_t &npoints,
+    hsize_t &start_in_patch
+)
+{
+    if( coarsening_[idim] > 1 ) {
+        // Each patch averages its own cells: no extra point in the first patch
+        npoints = patch_size_[idim] / coarsening_[idim];
+        offset_in_file = patch_coordinate * npoints;
+        start_in_patch = patch_offset_in_grid[idim] - 1;
+    } else {
+        offset_in_file = patch_coordinate * patch_size_[idim] + ( ( patch_coordinate==0 )?0:1 );
+        npoints = patch_size_[idim] + ( ( patch_coordinate==0 )?1:0 );
+        findSubgridIntersection1( idim, offset_in_file, npoints, start_in_patch );
+        start_in_patch += patch_offset_in_grid[idim] - ( ( patch_coordinate==0 )?1:0 );
+    }
+}
+
+// Creates the dataspace in file. Chunks are required above 2^28 points, and by the compression filters.
+// They are tiles made of whole patches, grown until they hold enough points to be worth compressing.
+H5Space *DiagnosticFields::createFilespace( vector<hsize_t> final_array_size )
+{
+    const hsize_t max_size = 4294967295/2/sizeof( double );
+    const hsize_t min_chunk_size = 1 << 18;
+    unsigned int ndim = final_array_size.size();
+    hsize_t final_size = 1;
+    for( unsigned int idim=0; idim<ndim; idim++ ) {
+        final_size *= final_array_size[idim];
+    }
+    
+    vector<hsize_t> chunk_size;
+    if( final_size > max_size || compression_ > 0 || compression_digits_ >= 0 ) {
+        chunk_size.resize( ndim );
+        hsize_t chunk_npoints = 1;
+        for( unsigned int idim=0; idim<ndim; idim++ ) {
+            chunk_size[idim] = max( ( hsize_t )1, ( hsize_t )( patch_size_[idim] / ( subgrid_step_[idim] * coarsening_[idim] ) ) );
+            chunk_size[idim] = min( chunk_size[idim], final_array_size[idim] );
+            chunk_npoints *= chunk_size[idim];
+        }
+        // Double the smallest side of the tile until it is large enough
+        while( chunk_npoints < min_chunk_size ) {
+            unsigned int imin = ndim;
+            for( unsigned int idim=0; idim<ndim; idim++ ) {
+                if( chunk_size[idim] < final_array_size[idim] && ( imin == ndim || chunk_size[idim] < chunk_size[imin] ) ) {
+                    imin = idim;
+                }
+            }
+            if( imin == ndim ) {
+                break;
+            }
+            chunk_npoints /= chunk_size[imin];
+            chunk_size[imin] = min( 2*chunk_size[imin], final_array_size[imin] );
+            chunk_npoints *= chunk_size[imin];
+        }
+    }
+    
+    H5Space *space = new H5Space( final_array_size, {}, {}, chunk_size );
+    space->deflate_ = compression_;
+    space->scaleoffset_ = compression_digits_;
+    return space;
+}
+
 void DiagnosticFields::findSubgridIntersection1(
     hsize_t idim,
     hsize_t &zone_offset,  // input = start of zone in full array / output = start of zone in the subgrid
@@ -39,6 +39,11 @@ public :
                                    hsize_t &zone_begin,
                                    hsize_t &zone_npoints,
                                    hsize_t &start_in_zone );
+    void findPatchIntersection( hsize_t idim,
+                                unsigned int patch_coordinate,
+                                hsize_t &offset_in_file,
+                                hsize_t &npoints,
+                                hsize_t &start_in_patch );
                                   
     //! Get memory footprint of current diagnostic
     int getMemFootPrint() override
@@ -68,6 +73,19 @@ protected :
     //! Subgrid requested
     std::vector<unsigned int> subgrid_start_, subgrid_stop_, subgrid_step_;
     
+    //! Number of cells averaged together in each direction
+    std::vector<unsigned int> coarsening_;
+    //! True if at least one direction is coarsened
+    bool coarsened_;
+    
+    //! Deflate level of the datasets (0 = no compression)
+    int compression_;
+    //! Number of decimal digits kept by the lossy compression (negative = lossless)
+    int compression_digits_;
+    
+    //! Create the dataspace in file, chunked in tiles of patches when needed
+    H5Space *createFilespace( std::vector<hsize_t> final_array_size );
+    
     //! Number of cells to skip in each direction
     std::vector<unsigned int> patch_offset_in_grid;
     //! Number of cells in each direction
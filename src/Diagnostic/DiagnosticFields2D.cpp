@@ -27,27 +27,20 @@ DiagnosticFields2D::DiagnosticFields2D( Params &params, SmileiMPI *smpi, VectorP
     
     // Get the full size of the array in file
     vector<hsize_t> final_array_size(2);
-    // Take subgrid into account
     for( unsigned int i=0; i<2; i++ ) {
-        hsize_t start = 0;
-        final_array_size[i] = params.number_of_patches[i] * params.patch_size_[i] + 1;
-        findSubgridIntersection1( i, start, final_array_size[i], start );
-    }
-    // Define the chunk size (necessary above 2^28 points)
-    const hsize_t max_size = 4294967295/2/sizeof( double );
-    hsize_t final_size = final_array_size[0] * final_array_size[1];
-    vector<hsize_t> chunk_size;
-    if( final_size > max_size ) {
-        hsize_t n_chunks = 1 + ( final_size-1 ) / max_size;
-        chunk_size.resize( 2 );
-        chunk_size[0] = final_array_size[0] / n_chunks;
-        chunk_size[1] = final_array_size[1];
-        if( n_chunks * chunk_size[0] < final_array_size[0] ) {
-            chunk_size[0]++;
+        if( coarsening_[i] > 1 ) {
+            // Coarsening: each patch averages its cells into patch_size_/coarsening points
+            final_array_size[i] = params.number_of_patches[i] * params.patch_size_[i] / coarsening_[i];
+        } else {
+            // Take subgrid into account
+            hsize_t start = 0;
+            final_array_size[i] = params.number_of_patches[i] * params.patch_size_[i] + 1;
+            findSubgridIntersection1( i, start, final_array_size[i], start );
         }
     }
+    hsize_t final_size = final_array_size[0] * final_array_size[1];
     
-    filespace = new H5Space( final_array_size, {}, {}, chunk_size );
+    filespace = createFilespace( final_array_size );
     memspace = new H5Space( 1 );
     
     // info for log output
@@ -98,9 +91,7 @@ void DiagnosticFields2D::setFileSplitting( SmileiMPI *, VectorPatch &vecPatches
     while( i < patch_ixy.size() ) {
         
         // For this line of patches at a given X, find the number of points in X
-        offset[0] = patch_ixy[i].x * patch_size_[0] + ( ( patch_ixy[i].x==0 )?0:1 );
-        npoints[0] = patch_size_[0] + ( ( patch_ixy[i].x==0 )?1:0 );
-        findSubgridIntersection1( 0, offset[0], npoints[0], start_in_patch[0] );
+        findPatchIntersection( 0, patch_ixy[i].x, offset[0], npoints[0], start_in_patch[0] );
         
         // Now iterate on the patches along Y that share the same X
         unsigned int i0 = i, npoints_y = 0;
@@ -108,9 +99,7 @@ void DiagnosticFields2D::setFileSplitting( SmileiMPI *, VectorPatch &vecPatches
             
             unsigned int ipatch = patch_ixy[i].i;
             // Find the number of points along Y for this patch
-            offset[1] = patch_ixy[i].y * patch_size_[1] + ( ( patch_ixy[i].y==0 )?0:1 );
-            npoints[1] = patch_size_[1] + ( ( patch_ixy[i].y==0 )?1:0 );
-            findSubgridIntersection1( 1, offset[1], npoints[1], start_in_patch[1] );
+            findPatchIntersection( 1, patch_ixy[i].y, offset[1], npoints[1], start_in_patch[1] );
             
             // Add this patch to the filespace
             H5Sselect_hyperslab( filespace->sid_, H5S_SELECT_OR, &offset[0], NULL, &count[0], &npoints[0] );
@@ -156,23 +145,42 @@ void DiagnosticFields2D::getField( Patch *patch, unsigned int ifield )
     // Find the intersection between this patch and the subgrid
     hsize_t patch_begin[2], patch_npoints[2], start_in_patch[2];
     for( unsigned int i=0; i<2; i++ ) {
-        patch_begin  [i] = patch->Pcoordinates[i] * patch_size_[i] + ( ( patch->Pcoordinates[i]==0 )?0:1 );
-        patch_npoints[i] = patch_size_[i] + ( ( patch->Pcoordinates[i]==0 )?1:0 );
-        findSubgridIntersection1( i, patch_begin[i], patch_npoints[i], start_in_patch[i] );
-        start_in_patch[i] += patch_offset_in_grid[i] - ( ( patch->Pcoordinates[i]==0 )?1:0 );
+        findPatchIntersection( i, patch->Pcoordinates[i], patch_begin[i], patch_npoints[i], start_in_patch[i] );
     }
     
-    // Copy field to the "data" buffer
-    unsigned int ix_max = start_in_patch[0] + subgrid_step_[0]*patch_npoints[0];
-    unsigned int iy_max = start_in_patch[1] + subgrid_step_[1]*patch_npoints[1];
     unsigned int iout = buffer_skip_y[patch->Hindex()-refHindex];
     unsigned int step_out = buffer_skip_x[patch->Hindex()-refHindex];
-    for( unsigned int ix = start_in_patch[0]; ix < ix_max; ix += subgrid_step_[0] ) {
-        for( unsigned int iy = start_in_patch[1]; iy < iy_max; iy += subgrid_step_[1] ) {
-            data[iout] = ( *field )( ix, iy ) * time_average_inv;
-            iout++;
+    
+    if( coarsened_ ) {
+        // Average blocks of cells to the "data" buffer
+        const unsigned int cx = coarsening_[0], cy = coarsening_[1];
+        const double factor = time_average_inv / ( double )( cx * cy );
+        for( unsigned int jx = 0; jx < patch_npoints[0]; jx++ ) {
+            unsigned int ix0 = start_in_patch[0] + jx * cx;
+            for( unsigned int jy = 0; jy < patch_npoints[1]; jy++ ) {
+                unsigned int iy0 = start_in_patch[1] + jy * cy;
+                double sum = 0.;
+                for( unsigned int ix = ix0; ix < ix0 + cx; ix++ ) {
+                    for( unsigned int iy = iy0; iy < iy0 + cy; iy++ ) {
+                        sum += ( *field )( ix, iy );
+                    }
+                }
+                data[iout] = sum * factor;
+                iout++;
+            }
+            iout += step_out;
+        }
+    } else {
+        // Copy field to the "data" buffer
+        unsigned int ix_max = start_in_patch[0] + subgrid_step_[0]*patch_npoints[0];
+        unsigned int iy_max = start_in_patch[1] + subgrid_step_[1]*patch_npoints[1];
+        for( unsigned int ix = start_in_patch[0]; ix < ix_max; ix += subgrid_step_[0] ) {
+            for( unsigned int iy = start_in_patch[1]; iy < iy_max; iy += subgrid_step_[1] ) {
+                data[iout] = ( *field )( ix, iy ) * time_average_inv;
+                iout++;
+            }
+            iout += step_out;
         }
-        iout += step_out;
     }
     
     if( time_average>1 ) {
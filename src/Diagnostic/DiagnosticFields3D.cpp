@@ -27,28 +27,20 @@ DiagnosticFields3D::DiagnosticFields3D( Params &params, SmileiMPI *smpi, VectorP
     
     // Get the full size of the array in file
     vector<hsize_t> final_array_size(3);
-    // Take subgrid into account
     for( unsigned int i=0; i<3; i++ ) {
-        hsize_t start = 0;
-        final_array_size[i] = params.number_of_patches[i] * params.patch_size_[i] + 1;
-        findSubgridIntersection1( i, start, final_array_size[i], start );
-    }
-    // Define the chunk size (necessary above 2^28 points)
-    const hsize_t max_size = 4294967295/2/sizeof( double );
-    hsize_t final_size = final_array_size[0] * final_array_size[1] * final_array_size[2];
-    vector<hsize_t> chunk_size;
-    if( final_size > max_size ) {
-        hsize_t n_chunks = 1 + ( final_size-1 ) / max_size;
-        chunk_size.resize( 3 );
-        chunk_size[0] = final_array_size[0] / n_chunks;
-        chunk_size[1] = final_array_size[1];
-        chunk_size[2] = final_array_size[2];
-        if( n_chunks * chunk_size[0] < final_array_size[0] ) {
-            chunk_size[0]++;
+        if( coarsening_[i] > 1 ) {
+            // Coarsening: each patch averages its cells into patch_size_/coarsening points
+            final_array_size[i] = params.number_of_patches[i] * params.patch_size_[i] / coarsening_[i];
+        } else {
+            // Take subgrid into account
+            hsize_t start = 0;
+            final_array_size[i] = params.number_of_patches[i] * params.patch_size_[i] + 1;
+            findSubgridIntersection1( i, start, final_array_size[i], start );
         }
     }
+    hsize_t final_size = final_array_size[0] * final_array_size[1] * final_array_size[2];
     
-    filespace = new H5Space( final_array_size, {}, {}, chunk_size );
+    filespace = createFilespace( final_array_size );
     memspace = new H5Space( 1 );
     
     // info for log output
@@ -106,18 +98,14 @@ void DiagnosticFields3D::setFileSplitting( SmileiMPI *, VectorPatch &vecPatches
     while( i < patch_ixyz.size() ) {
         
         // For this slab of patches at a given X, find the number of points in X
-        offset[0] = patch_ixyz[i].x * patch_size_[0] + ( ( patch_ixyz[i].x==0 )?0:1 );
-        npoints[0] = patch_size_[0] + ( ( patch_ixyz[i].x==0 )?1:0 );
-        findSubgridIntersection1( 0, offset[0], npoints[0], start_in_patch[0] );
+        findPatchIntersection( 0, patch_ixyz[i].x, offset[0], npoints[0], start_in_patch[0] );
         
         // Now iterate on the patches along Y & Z that share the same X
         unsigned int i0 = i, npoints_yz = 0;
         while( i < patch_ixyz.size() && patch_ixyz[i].x == patch_ixyz[i0].x ) {
             
             // For this line of patches at a given Y, find the number of points in Y
-            offset[1] = patch_ixyz[i].y * patch_size_[1] + ( ( patch_ixyz[i].y==0 )?0:1 );
-            npoints[1] = patch_size_[1] + ( ( patch_ixyz[i].y==0 )?1:0 );
-            findSubgridIntersection1( 1, offset[1], npoints[1], start_in_patch[1] );
+            findPatchIntersection( 1, patch_ixyz[i].y, offset[1], npoints[1], start_in_patch[1] );
             
             // Now iterate on the patches along Z that share the same Y & X
             unsigned int i1 = i, npoints_z = 0;
@@ -125,9 +113,7 @@ void DiagnosticFields3D::setFileSplitting( SmileiMPI *, VectorPatch &vecPatches
                 
                 unsigned int ipatch = patch_ixyz[i].i;
                 // Find the number of points along Z for this patch
-                offset[2] = patch_ixyz[i].z * patch_size_[2] + ( ( patch_ixyz[i].z==0 )?0:1 );
-                npoints[2] = patch_size_[2] + ( ( patch_ixyz[i].z==0 )?1:0 );
-                findSubgridIntersection1( 2, offset[2], npoints[2], start_in_patch[2] );
+                findPatchIntersection( 2, patch_ixyz[i].z, offset[2], npoints[2], start_in_patch[2] );
                 
                 // Add this patch to the filespace
                 H5Sselect_hyperslab( filespace->sid_, H5S_SELECT_OR, &offset[0], NULL, &count[0], &npoints[0] );
@@ -185,28 +171,53 @@ void DiagnosticFields3D::getField( Patch *patch, unsigned int ifield )
     // Find the intersection between this patch and the subgrid
     hsize_t patch_begin[3], patch_npoints[3], start_in_patch[3];
     for( unsigned int i=0; i<3; i++ ) {
-        patch_begin  [i] = patch->Pcoordinates[i] * patch_size_[i] + ( ( patch->Pcoordinates[i]==0 )?0:1 );
-        patch_npoints[i] = patch_size_[i] + ( ( patch->Pcoordinates[i]==0 )?1:0 );
-        findSubgridIntersection1( i, patch_begin[i], patch_npoints[i], start_in_patch[i] );
-        start_in_patch[i] += patch_offset_in_grid[i] - ( ( patch->Pcoordinates[i]==0 )?1:0 );
+        findPatchIntersection( i, patch->Pcoordinates[i], patch_begin[i], patch_npoints[i], start_in_patch[i] );
     }
     
-    // Copy field to the "data" buffer
-    unsigned int ix_max = start_in_patch[0] + subgrid_step_[0]*patch_npoints[0];
-    unsigned int iy_max = start_in_patch[1] + subgrid_step_[1]*patch_npoints[1];
-    unsigned int iz_max = start_in_patch[2] + subgrid_step_[2]*patch_npoints[2];
     unsigned int iout = buffer_skip_z[patch->Hindex()-refHindex];
     unsigned int stepy_out = buffer_skip_y[patch->Hindex()-refHindex];
     unsigned int stepx_out = buffer_skip_x[patch->Hindex()-refHindex];
-    for( unsigned int ix = start_in_patch[0]; ix < ix_max; ix += subgrid_step_[0] ) {
-        for( unsigned int iy = start_in_patch[1]; iy < iy_max; iy += subgrid_step_[1] ) {
-            for( unsigned int iz = start_in_patch[2]; iz < iz_max; iz += subgrid_step_[2] ) {
-                data[iout] = ( *field )( ix, iy, iz ) * time_average_inv;
-                iout++;
+    
+    if( coarsened_ ) {
+        // Average blocks of cells to the "data" buffer
+        const unsigned int cx = coarsening_[0], cy = coarsening_[1], cz = coarsening_[2];
+        const double factor = time_average_inv / ( double )( cx * cy * cz );
+        for( unsigned int jx = 0; jx < patch_npoints[0]; jx++ ) {
+            unsigned int ix0 = start_in_patch[0] + jx * cx;
+            for( unsigned int jy = 0; jy < patch_npoints[1]; jy++ ) {
+                unsigned int iy0 = start_in_patch[1] + jy * cy;
+                for( unsigned int jz = 0; jz < patch_npoints[2]; jz++ ) {
+                    unsigned int iz0 = start_in_patch[2] + jz * cz;
+                    double sum = 0.;
+                    for( unsigned int ix = ix0; ix < ix0 + cx; ix++ ) {
+                        for( unsigned int iy = iy0; iy < iy0 + cy; iy++ ) {
+                            for( unsigned int iz = iz0; iz < iz0 + cz; iz++ ) {
+                                sum += ( *field )( ix, iy, iz );
+                            }
+                        }
+                    }
+                    data[iout] = sum * factor;
+                    iout++;
+                }
+                iout += stepy_out;
+            }
+            iout += stepx_out;
+        }
+    } else {
+        // Copy field to the "data" buffer
+        unsigned int ix_max = start_in_patch[0] + subgrid_step_[0]*patch_npoints[0];
+        unsigned int iy_max = start_in_patch[1] + subgrid_step_[1]*patch_npoints[1];
+        unsigned int iz_max = start_in_patch[2] + subgrid_step_[2]*patch_npoints[2];
+        for( unsigned int ix = start_in_patch[0]; ix < ix_max; ix += subgrid_step_[0] ) {
+            for( unsigned int iy = start_in_patch[1]; iy < iy_max; iy += subgrid_step_[1] ) {
+                for( unsigned int iz = start_in_patch[2]; iz < iz_max; iz += subgrid_step_[2] ) {
+                    data[iout] = ( *field )( ix, iy, iz ) * time_average_inv;
+                    iout++;
+                }
+                iout += stepy_out;
             }
-            iout += stepy_out;
+            iout += stepx_out;
         }
-        iout += stepx_out;
     }
     
     if( time_average>1 ) {
@@ -37,7 +37,7 @@ DiagnosticNewParticles::~DiagnosticNewParticles()
 void DiagnosticNewParticles::openFile( Params &params, SmileiMPI *smpi )
 {
     // Create HDF5 file
-    file_ = new H5Write( filename, &smpi->world() );
+    file_ = new H5Write( filename, &smpi->world(), true, smpi->diagnosticsIOInfo() );
     file_->attr( "name", diag_name_ );
     
     // Groups for openPMD
@@ -14,6 +14,8 @@ DiagnosticParticleBinning::DiagnosticParticleBinning(
     int diagId
 ) : DiagnosticParticleBinningBase( params, smpi, patch, diagId, "ParticleBinning", false, nullptr, excludedAxes() )
 {
+    // get parameter "sparse" that determines whether only the non-empty bins are stored
+    PyTools::extract( "sparse", sparse_, "DiagParticleBinning", diagId );
 }
 
 DiagnosticParticleBinning::~DiagnosticParticleBinning()
@@ -22,6 +22,7 @@ DiagnosticParticleBinningBase::DiagnosticParticleBinningBase(
 {
     int idiag = diagId;
     time_accumulate = time_accumulate_;
+    sparse_ = false;
     
     string pyDiag = Tools::merge( "Diag", diagName );
     string errorPrefix = Tools::merge( pyDiag, " #", to_string( idiag ) );
@@ -225,6 +226,15 @@ bool DiagnosticParticleBinningBase::prepare( int itime )
         return false;
     }
     
+    if( sparse_ ) {
+        // if first time, erase the list of non-empty bins
+        if( itime == previousTime_ ) {
+            sparse_index_.resize( 0 );
+            sparse_data_.resize( 0 );
+        }
+        return true;
+    }
+    
     // Allocate memory for the output array (already done if time-averaging)
     data_sum.resize( output_size );
     
@@ -321,7 +331,17 @@ void DiagnosticParticleBinningBase::run( Patch *patch, int, SimWindow *simWindow
     
     histogram->digitize( species, double_buffer, int_buffer, simWindow );
     histogram->valuate( species, double_buffer, int_buffer );
-    histogram->distribute( double_buffer, int_buffer, data_sum );
+    
+    if( sparse_ ) {
+        // Bin the patch data locally, then merge with the other patches
+        vector<int> index;
+        vector<double> data;
+        histogram->distributeSparse( double_buffer, int_buffer, index, data );
+        #pragma omp critical
+        Histogram::mergeSparse( sparse_index_, sparse_data_, index, data );
+    } else {
+        histogram->distribute( double_buffer, int_buffer, data_sum );
+    }
     
 } // END run
 
@@ -340,8 +360,14 @@ void DiagnosticParticleBinningBase::write( int itime, SmileiMPI *smpi )
     // if time_average, then we need to divide by the number of timesteps
     if( !time_accumulate && time_average > 1 ) {
         double coeff = 1./( ( double )time_average );
-        for( unsigned int i=0; i<output_size; i++ ) {
-            data_sum[i] *= coeff;
+        if( sparse_ ) {
+            for( unsigned int i=0; i<sparse_data_.size(); i++ ) {
+                sparse_data_[i] *= coeff;
+            }
+        } else {
+            for( unsigned int i=0; i<output_size; i++ ) {
+                data_sum[i] *= coeff;
+            }
         }
     }
     
@@ -352,20 +378,22 @@ void DiagnosticParticleBinningBase::write( int itime, SmileiMPI *smpi )
     string dataname = mystream.str();
     
     // write the array if it does not exist already
-    if( ! file_->has( dataname ) ) {
+    if( sparse_ && ! file_->has( dataname ) ) {
+        // A group containing the flattened indices of the non-empty bins and their values
+        H5Write group = file_->group( dataname );
+        vector<unsigned int> shape( dims.begin(), dims.end() );
+        group.attr( "sparse_shape", shape );
+        if( sparse_index_.size() == 0 ) {
+            sparse_index_.push_back( 0 );
+            sparse_data_.push_back( 0. );
+        }
+        group.vect( "indices", sparse_index_ );
+        group.vect( "values", sparse_data_ );
+        writeAutoLimits( group );
+    } else if( ! file_->has( dataname ) ) {
         H5Space d( dims );
         H5Write dataset = file_->array( dataname, data_sum[0], &d, &d );
-        
-        // When auto limits, write the limits
-        for( unsigned int iaxis=0 ; iaxis < histogram->axes.size() ; iaxis++ ) {
-            HistogramAxis * ax = histogram->axes[iaxis];
-            if( std::isnan(ax->min) ) {
-                dataset.attr( "min"+to_string(iaxis), ax->global_min );
-            }
-            if( std::isnan(ax->max) ) {
-                dataset.attr( "max"+to_string(iaxis), ax->global_max );
-            }
-        }
+        writeAutoLimits( dataset );
     }
     
     if( flush_timeSelection->theTimeIsNow( itime ) ) {
@@ -380,11 +408,28 @@ void DiagnosticParticleBinningBase::write( int itime, SmileiMPI *smpi )
 } // END write
 
 
+// When auto limits, write the limits
+void DiagnosticParticleBinningBase::writeAutoLimits( H5Write &dataset )
+{
+    for( unsigned int iaxis=0 ; iaxis < histogram->axes.size() ; iaxis++ ) {
+        HistogramAxis * ax = histogram->axes[iaxis];
+        if( std::isnan(ax->min) ) {
+            dataset.attr( "min"+to_string(iaxis), ax->global_min );
+        }
+        if( std::isnan(ax->max) ) {
+            dataset.attr( "max"+to_string(iaxis), ax->global_max );
+        }
+    }
+}
+
+
 //! Clear the array
 void DiagnosticParticleBinningBase::clear()
 {
     data_sum.resize( 0 );
     vector<double>().swap( data_sum );
+    vector<int>().swap( sparse_index_ );
+    vector<double>().swap( sparse_data_ );
 }
 
 
@@ -48,7 +48,7 @@ public :
     //! Get memory footprint of current diagnostic
     int getMemFootPrint() override
     {
-        int size = output_size*sizeof( double );
+        int size = sparse_ ? sparse_data_.size()*( sizeof( double )+sizeof( int ) ) : output_size*sizeof( double );
         // + data_array + index_array +  axis_array
         // + nparts_max * (sizeof(double)+sizeof(int)+sizeof(double))
         return size;
@@ -73,6 +73,13 @@ protected:
     //! vector for saving the output array for time-averaging
     std::vector<double> data_sum;
     
+    //! True if the output array is stored as a sparse list of non-empty bins instead of data_sum
+    bool sparse_;
+    
+    //! Sparse output array: sorted indices of the non-empty bins, and their values
+    std::vector<int> sparse_index_;
+    std::vector<double> sparse_data_;
+    
     //! Histogram object
     Histogram *histogram;
     
@@ -85,6 +92,9 @@ protected:
     
     bool has_auto_limits_;
     
+    //! Write the axes limits computed automatically as attributes of the output
+    void writeAutoLimits( H5Write &dataset );
+    
 //    //! Minimum and maximum spatial coordinates that are useful for this diag
 //    std::vector<double> spatial_min, spatial_max;
 };
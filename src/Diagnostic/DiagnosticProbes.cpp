@@ -432,7 +432,7 @@ DiagnosticProbes::~DiagnosticProbes()
 
 void DiagnosticProbes::openFile( Params &, SmileiMPI *smpi )
 {
-    file_ = new H5Write( filename, &smpi->world() );
+    file_ = new H5Write( filename, &smpi->world(), true, smpi->diagnosticsIOInfo() );
     
     file_->attr( "name", diag_name_ );
     file_->attr( "Version", string( __VERSION ) );
@@ -39,7 +39,7 @@ DiagnosticTrack::~DiagnosticTrack()
 void DiagnosticTrack::openFile( Params &, SmileiMPI *smpi )
 {
     // Create HDF5 file
-    file_ = new H5Write( filename, &smpi->world() );
+    file_ = new H5Write( filename, &smpi->world(), true, smpi->diagnosticsIOInfo() );
     file_->attr( "name", diag_name_ );
     
     // Attributes for openPMD
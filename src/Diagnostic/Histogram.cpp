@@ -115,6 +115,79 @@ void Histogram::distribute(
     
 }
 
+void Histogram::distributeSparse(
+    std::vector<double> &double_buffer,
+    std::vector<int>    &int_buffer,
+    std::vector<int>    &output_index,
+    std::vector<double> &output_data )
+{
+
+    unsigned int npart=double_buffer.size();
+    
+    // Keep only the particles that were not discarded
+    vector<pair<int, double> > contributions;
+    contributions.reserve( npart );
+    for( unsigned int ipart = 0 ; ipart < npart ; ipart++ ) {
+        if( int_buffer[ipart] >= 0 ) {
+            contributions.push_back( make_pair( int_buffer[ipart], double_buffer[ipart] ) );
+        }
+    }
+    
+    // Sort by index, then sum contributions of the same bin
+    sort( contributions.begin(), contributions.end() );
+    output_index.resize( 0 );
+    output_data.resize( 0 );
+    for( unsigned int i = 0 ; i < contributions.size() ; i++ ) {
+        if( output_index.size() > 0 && output_index.back() == contributions[i].first ) {
+            output_data.back() += contributions[i].second;
+        } else {
+            output_index.push_back( contributions[i].first );
+            output_data.push_back( contributions[i].second );
+        }
+    }
+}
+
+// Merge the sorted list (index2, data2) into the sorted list (index1, data1)
+void Histogram::mergeSparse(
+    std::vector<int>    &index1,
+    std::vector<double> &data1,
+    std::vector<int>    &index2,
+    std::vector<double> &data2 )
+{
+    if( index2.size() == 0 ) {
+        return;
+    }
+    if( index1.size() == 0 ) {
+        index1 = index2;
+        data1 = data2;
+        return;
+    }
+    
+    vector<int> index;
+    vector<double> data;
+    index.reserve( index1.size() + index2.size() );
+    data.reserve( index1.size() + index2.size() );
+    unsigned int i1 = 0, i2 = 0;
+    while( i1 < index1.size() || i2 < index2.size() ) {
+        if( i2 == index2.size() || ( i1 < index1.size() && index1[i1] < index2[i2] ) ) {
+            index.push_back( index1[i1] );
+            data.push_back( data1[i1] );
+            i1++;
+        } else if( i1 == index1.size() || index2[i2] < index1[i1] ) {
+            index.push_back( index2[i2] );
+            data.push_back( data2[i2] );
+            i2++;
+        } else {
+            index.push_back( index1[i1] );
+            data.push_back( data1[i1] + data2[i2] );
+            i1++;
+            i2++;
+        }
+    }
+    index1.swap( index );
+    data1.swap( data );
+}
+
 
 
 void HistogramAxis::init( string type_, double min_, double max_, int nbins_, bool logscale_, bool edge_inclusive_, vector<double> coefficients_ )
@@ -95,6 +95,10 @@ public:
     };
     //! Add the contribution of each particle in the histogram
     void distribute( std::vector<double> &, std::vector<int> &, std::vector<double> & );
+    //! Same as `distribute` but outputs a sparse histogram (sorted list of indices and values)
+    void distributeSparse( std::vector<double> &, std::vector<int> &, std::vector<int> &, std::vector<double> & );
+    //! Merge a sparse histogram into another one (both sorted by index)
+    static void mergeSparse( std::vector<int> &, std::vector<double> &, std::vector<int> &, std::vector<double> & );
 
     std::string deposited_quantity;
 
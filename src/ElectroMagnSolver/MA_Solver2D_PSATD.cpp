@@ -0,0 +1,20 @@
+
+#include "MA_Solver2D_PSATD.h"
+
+#include "ElectroMagn.h"
+
+MA_Solver2D_PSATD::MA_Solver2D_PSATD( Params &params )
+    : Solver2D( params ),
+      psatd_( params )
+{
+}
+
+MA_Solver2D_PSATD::~MA_Solver2D_PSATD()
+{
+}
+
+void MA_Solver2D_PSATD::operator()( ElectroMagn *fields )
+{
+    psatd_.advance( fields );
+}
+
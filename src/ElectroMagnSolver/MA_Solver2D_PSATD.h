@@ -0,0 +1,27 @@
+#ifndef MA_SOLVER2D_PSATD_H
+#define MA_SOLVER2D_PSATD_H
+
+#include "Solver2D.h"
+#include "PSATD.h"
+class ElectroMagn;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class MA_Solver2D_PSATD: native spectral solver, advances both E and B (the Maxwell-Faraday solver is a NullSolver)
+//  --------------------------------------------------------------------------------------------------------------------
+class MA_Solver2D_PSATD : public Solver2D
+{
+
+public:
+    MA_Solver2D_PSATD( Params &params );
+    virtual ~MA_Solver2D_PSATD();
+    
+    //! Overloading of () operator
+    virtual void operator()( ElectroMagn *fields ) override;
+    
+protected:
+    PSATD psatd_;
+
+};//END class
+
+#endif
+
@@ -0,0 +1,20 @@
+
+#include "MA_Solver3D_PSATD.h"
+
+#include "ElectroMagn.h"
+
+MA_Solver3D_PSATD::MA_Solver3D_PSATD( Params &params )
+    : Solver3D( params ),
+      psatd_( params )
+{
+}
+
+MA_Solver3D_PSATD::~MA_Solver3D_PSATD()
+{
+}
+
+void MA_Solver3D_PSATD::operator()( ElectroMagn *fields )
+{
+    psatd_.advance( fields );
+}
+
@@ -0,0 +1,27 @@
+#ifndef MA_SOLVER3D_PSATD_H
+#define MA_SOLVER3D_PSATD_H
+
+#include "Solver3D.h"
+#include "PSATD.h"
+class ElectroMagn;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class MA_Solver3D_PSATD: native spectral solver, advances both E and B (the Maxwell-Faraday solver is a NullSolver)
+//  --------------------------------------------------------------------------------------------------------------------
+class MA_Solver3D_PSATD : public Solver3D
+{
+
+public:
+    MA_Solver3D_PSATD( Params &params );
+    virtual ~MA_Solver3D_PSATD();
+    
+    //! Overloading of () operator
+    virtual void operator()( ElectroMagn *fields ) override;
+    
+protected:
+    PSATD psatd_;
+
+};//END class
+
+#endif
+
@@ -0,0 +1,246 @@
+#include "PSATD.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "ElectroMagn.h"
+#include "Field.h"
+
+using namespace std;
+
+//! i*z without the NaN recovery of the complex product
+static inline dcomplex timesI( dcomplex z )
+{
+    return dcomplex( -z.imag(), z.real() );
+}
+
+PSATD::PSATD( Params &params ) :
+    dt_( params.timestep ),
+    cell_length_( params.cell_length ),
+    order_( params.spectral_solver_order ),
+    size_( 0 )
+{
+    cell_length_.resize( 3, 1. );
+    order_.resize( 3, 0 );
+}
+
+PSATD::~PSATD()
+{
+    for( unsigned int i=0; i<fft_.size(); i++ ) {
+        delete fft_[i];
+    }
+}
+
+void PSATD::init( vector<unsigned int> dims )
+{
+    for( unsigned int i=0; i<fft_.size(); i++ ) {
+        delete fft_[i];
+    }
+    fft_.resize( 3 );
+    k_.resize( 3 );
+    shift_.resize( 3 );
+    n_ = dims;
+    size_ = n_[0]*n_[1]*n_[2];
+
+    for( unsigned int idim=0; idim<3; idim++ ) {
+        unsigned int n = n_[idim];
+        double dx = cell_length_[idim];
+        fft_[idim] = new FFT( n );
+
+        // Weights of the staggered centered derivative of order 2M, on the points +-(j-1/2)dx
+        // (order 0 is the infinite-order, exact derivative)
+        unsigned int M = order_[idim] > 0 ? max( 1, order_[idim]/2 ) : 0;
+        vector<double> w( M );
+        for( unsigned int j=0; j<M; j++ ) {
+            double aj = j+0.5;
+            w[j] = 1./( 2.*aj );
+            for( unsigned int l=0; l<M; l++ ) {
+                if( l != j ) {
+                    double al = l+0.5;
+                    w[j] *= al*al / ( al*al - aj*aj );
+                }
+            }
+        }
+
+        k_[idim].resize( n );
+        shift_[idim].resize( n );
+        for( unsigned int i=0; i<n; i++ ) {
+            int m = ( i < ( n+1 )/2 ) ? ( int )i : ( int )i - ( int )n;
+            // (unused dimensions have a single, null wavenumber)
+            double k = ( n > 1 ) ? 2.*M_PI*( double )m / ( ( double )n*dx ) : 0.;
+            if( M == 0 ) {
+                k_[idim][i] = k;
+            } else {
+                k_[idim][i] = 0.;
+                for( unsigned int j=0; j<M; j++ ) {
+                    k_[idim][i] += 2.*w[j]*sin( k*( j+0.5 )*dx ) / dx;
+                }
+            }
+            shift_[idim][i] = dcomplex( cos( 0.5*k*dx ), sin( 0.5*k*dx ) );
+        }
+    }
+
+    spectrum_.resize( 10 );
+    for( unsigned int i=0; i<spectrum_.size(); i++ ) {
+        spectrum_[i].resize( size_ );
+    }
+}
+
+void PSATD::transform( dcomplex *data, int sign )
+{
+    // Axis by axis: each line is gathered in a buffer, transformed and scattered back
+    for( unsigned int idim=0; idim<3; idim++ ) {
+        unsigned int n = n_[idim];
+        if( n == 1 ) {
+            continue;
+        }
+        unsigned int stride = 1;
+        for( unsigned int jdim=idim+1; jdim<3; jdim++ ) {
+            stride *= n_[jdim];
+        }
+        unsigned int nlines = size_ / n;
+        FFT *fft = fft_[idim];
+
+        #pragma omp parallel
+        {
+            vector<dcomplex> line( n );
+            #pragma omp for schedule(static)
+            for( unsigned int iline=0; iline<nlines; iline++ ) {
+                dcomplex *start = data + ( iline/stride )*n*stride + iline%stride;
+                fft->transform( start, stride, &line[0], sign );
+                for( unsigned int i=0; i<n; i++ ) {
+                    start[i*stride] = line[i];
+                }
+            }
+        }
+    }
+}
+
+void PSATD::advance( ElectroMagn *fields )
+{
+    vector<unsigned int> dims = fields->Ex_->dims_;
+    dims.resize( 3, 1 );
+    if( dims != n_ ) {
+        init( dims );
+    }
+
+    Field *E[3] = { fields->Ex_, fields->Ey_, fields->Ez_ };
+    Field *B[3] = { fields->Bx_, fields->By_, fields->Bz_ };
+    Field *J[3] = { fields->Jx_, fields->Jy_, fields->Jz_ };
+    const double *rho = fields->rho_->data();
+    double *rhoold = fields->rhoold_->data();
+
+    // Forward transforms
+    for( unsigned int i=0; i<3; i++ ) {
+        dcomplex *sE = &spectrum_[i  ][0];
+        dcomplex *sB = &spectrum_[i+3][0];
+        dcomplex *sJ = &spectrum_[i+6][0];
+        const double *e = E[i]->data();
+        const double *b = B[i]->data();
+        const double *j = J[i]->data();
+        #pragma omp parallel for schedule(static)
+        for( unsigned int p=0; p<size_; p++ ) {
+            sE[p] = e[p];
+            sB[p] = b[p];
+            sJ[p] = j[p];
+        }
+    }
+    dcomplex *sRho = &spectrum_[9][0];
+    #pragma omp parallel for schedule(static)
+    for( unsigned int p=0; p<size_; p++ ) {
+        sRho[p] = rho[p] - rhoold[p];
+    }
+    for( unsigned int i=0; i<spectrum_.size(); i++ ) {
+        transform( &spectrum_[i][0], -1 );
+    }
+
+    // Analytical integration over dt of each Fourier mode
+    // Ex, Jx (d,p,p), Ey, Jy (p,d,p), Ez, Jz (p,p,d), Bx (p,d,d), By (d,p,d), Bz (d,d,p), rho (p,p,p)
+    const double norm = 1./( double )size_;
+    const unsigned int n0 = n_[0], n1 = n_[1], n2 = n_[2];
+    dcomplex *sEx = &spectrum_[0][0], *sEy = &spectrum_[1][0], *sEz = &spectrum_[2][0];
+    dcomplex *sBx = &spectrum_[3][0], *sBy = &spectrum_[4][0], *sBz = &spectrum_[5][0];
+    const dcomplex *sJx = &spectrum_[6][0], *sJy = &spectrum_[7][0], *sJz = &spectrum_[8][0];
+    #pragma omp parallel for schedule(static)
+    for( unsigned int i0=0; i0<n0; i0++ ) {
+        const double kx = k_[0][i0];
+        const dcomplex sx = shift_[0][i0];
+        for( unsigned int i1=0; i1<n1; i1++ ) {
+            const double ky = k_[1][i1];
+            const dcomplex sy = shift_[1][i1];
+            const dcomplex sxy = complexProduct( sx, sy );
+            for( unsigned int i2=0; i2<n2; i2++ ) {
+                const unsigned int p = ( i0*n1 + i1 )*n2 + i2;
+                const double kz = k_[2][i2];
+                const dcomplex sz = shift_[2][i2];
+                const dcomplex sxz = complexProduct( sx, sz );
+                const dcomplex syz = complexProduct( sy, sz );
+
+                // Values collocated on the primal grid
+                dcomplex Ex = complexProduct( sEx[p], sx  ), Ey = complexProduct( sEy[p], sy  ), Ez = complexProduct( sEz[p], sz  );
+                dcomplex Bx = complexProduct( sBx[p], syz ), By = complexProduct( sBy[p], sxz ), Bz = complexProduct( sBz[p], sxy );
+                dcomplex Jx = complexProduct( sJx[p], sx  ), Jy = complexProduct( sJy[p], sy  ), Jz = complexProduct( sJz[p], sz  );
+
+                const double k2 = kx*kx + ky*ky + kz*kz;
+                if( k2 == 0. ) {
+                    Ex -= dt_*Jx;
+                    Ey -= dt_*Jy;
+                    Ez -= dt_*Jz;
+                } else {
+                    const double kappa = sqrt( k2 );
+                    const double C = cos( kappa*dt_ );
+                    const double S = sin( kappa*dt_ );
+                    const double ux = kx/kappa, uy = ky/kappa, uz = kz/kappa;
+
+                    // Longitudinal E, from Gauss's law and the variation of the density
+                    const dcomplex EkE = ux*Ex + uy*Ey + uz*Ez;
+                    const dcomplex EL = EkE - timesI( sRho[p] )/kappa;
+                    const dcomplex JkJ = ux*Jx + uy*Jy + uz*Jz;
+
+                    const dcomplex uxBx = uy*Bz - uz*By, uxBy = uz*Bx - ux*Bz, uxBz = ux*By - uy*Bx;
+                    const dcomplex uxEx = uy*Ez - uz*Ey, uxEy = uz*Ex - ux*Ez, uxEz = ux*Ey - uy*Ex;
+                    const dcomplex uxJx = uy*Jz - uz*Jy, uxJy = uz*Jx - ux*Jz, uxJz = ux*Jy - uy*Jx;
+
+                    Ex = C*( Ex - ux*EkE ) + S*timesI( uxBx ) - ( S/kappa )*( Jx - ux*JkJ ) + ux*EL;
+                    Ey = C*( Ey - uy*EkE ) + S*timesI( uxBy ) - ( S/kappa )*( Jy - uy*JkJ ) + uy*EL;
+                    Ez = C*( Ez - uz*EkE ) + S*timesI( uxBz ) - ( S/kappa )*( Jz - uz*JkJ ) + uz*EL;
+
+                    Bx = C*Bx - S*timesI( uxEx ) + ( ( 1.-C )/kappa )*timesI( uxJx );
+                    By = C*By - S*timesI( uxEy ) + ( ( 1.-C )/kappa )*timesI( uxJy );
+                    Bz = C*Bz - S*timesI( uxEz ) + ( ( 1.-C )/kappa )*timesI( uxJz );
+                }
+
+                // Back to the staggered grids, with the normalization of the backward transform
+                sEx[p] = norm*complexProduct( Ex, conj( sx  ) );
+                sEy[p] = norm*complexProduct( Ey, conj( sy  ) );
+                sEz[p] = norm*complexProduct( Ez, conj( sz  ) );
+                sBx[p] = norm*complexProduct( Bx, conj( syz ) );
+                sBy[p] = norm*complexProduct( By, conj( sxz ) );
+                sBz[p] = norm*complexProduct( Bz, conj( sxy ) );
+            }
+        }
+    }
+
+    // Backward transforms
+    for( unsigned int i=0; i<6; i++ ) {
+        transform( &spectrum_[i][0], 1 );
+    }
+    for( unsigned int i=0; i<3; i++ ) {
+        const dcomplex *sE = &spectrum_[i  ][0];
+        const dcomplex *sB = &spectrum_[i+3][0];
+        double *e = E[i]->data();
+        double *b = B[i]->data();
+        #pragma omp parallel for schedule(static)
+        for( unsigned int p=0; p<size_; p++ ) {
+            e[p] = sE[p].real();
+            b[p] = sB[p].real();
+        }
+    }
+
+    memcpy( rhoold, rho, size_*sizeof( double ) );
+
+    // E and B are known at the same time: particles are pushed with B itself
+    if( fields->Bx_m->data() != fields->Bx_->data() ) {
+        fields->saveMagneticFields( true );
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef PSATD_H
+#define PSATD_H
+
+#include <vector>
+
+#include "dcomplex.h"
+#include "FFT.h"
+#include "Params.h"
+
+class ElectroMagn;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PSATD: pseudo-spectral analytical time-domain update of E and B on the local grid (patch or region)
+//! The local grid, ghost cells included, is treated as periodic: ghost cells must be wider than the stencil.
+//! Fields keep the staggering of the Yee lattice (spectral layout: all arrays have the primal size).
+//  --------------------------------------------------------------------------------------------------------------------
+class PSATD
+{
+
+public:
+    PSATD( Params &params );
+    ~PSATD();
+
+    //! Advances E and B from t to t+dt using J at t+dt/2 and rho at t and t+dt
+    //! rhoold is then overwritten with rho
+    void advance( ElectroMagn *fields );
+
+private:
+    //! Builds the wavenumbers and the FFTs for new local dimensions (3 values, 1 for unused dimensions)
+    void init( std::vector<unsigned int> dims );
+
+    //! Multi-dimensional in-place FFT of one array
+    void transform( dcomplex *data, int sign );
+
+    double dt_;
+    std::vector<double> cell_length_;
+    std::vector<int> order_;
+
+    //! Local dimensions and total size
+    std::vector<unsigned int> n_;
+    unsigned int size_;
+
+    //! 1D transforms along each dimension
+    std::vector<FFT *> fft_;
+
+    //! Modified wavenumbers (of the finite-order staggered stencil) along each dimension
+    std::vector<std::vector<double>> k_;
+    //! Half-cell shifts exp( i k dx/2 ) of the dual grids along each dimension
+    std::vector<std::vector<dcomplex>> shift_;
+
+    //! Spectra of E, B, J and of the density variation
+    std::vector<std::vector<dcomplex>> spectrum_;
+};
+
+#endif
@@ -5,8 +5,10 @@
 #include "MA_Solver1D_Friedman.h"
 #include "MA_Solver2D_norm.h"
 #include "MA_Solver2D_Friedman.h"
+#include "MA_Solver2D_PSATD.h"
 #include "MA_Solver3D_norm.h"
 #include "MA_Solver3D_Friedman.h"
+#include "MA_Solver3D_PSATD.h"
 #include "MA_SolverAM_norm.h"
 #include "MA_SolverAM_Friedman.h"
 #include "MF_Solver1D_Yee.h"
@@ -67,7 +69,11 @@ public:
         } else if( params.geometry == "2Dcartesian" ) {
 
             if( params.is_spectral ) {
-                solver = new PXR_Solver2D_GPSTD( params );
+                if( params.use_picsar ) {
+                    solver = new PXR_Solver2D_GPSTD( params );
+                } else {
+                    solver = new MA_Solver2D_PSATD( params );
+                }
             } else if( params.Friedman_filter ) {
                 if ( (params.maxwell_sol != "Yee") && (params.maxwell_sol != "Bouchard") && (params.maxwell_sol != "Grassi") && (params.maxwell_sol != "GrassiSpL") ){
                     ERROR( "Only Yee, Bouchard, Grassi and GrassiSpL Maxwell solvers are compatible with Friedman filter in 2Dcartesian geometry" );
@@ -80,10 +86,10 @@ public:
         } else if( params.geometry == "3Dcartesian" ) {
 
             if( params.is_spectral ) {
-                if( params.is_pxr ) {
+                if( params.use_picsar ) {
                     solver = new PXR_Solver3D_GPSTD( params );
                 } else {
-                    ERROR( "Spectral solver not available without Picsar" );
+                    solver = new MA_Solver3D_PSATD( params );
                 }
             } else {
                 if( params.is_pxr ) {
@@ -1,5 +1,23 @@
 #ifndef DCOMPLEX_H_
 #define DCOMPLEX_H_
+#include <complex>
 #define Icpx dcomplex(0.0,1.0)
 typedef std::complex<double> dcomplex;
+
+//! Real part of f*(re + i im), in real arithmetic
+inline double __attribute__((always_inline)) realProduct( dcomplex f, double re, double im )
+{
+    return std::real( f )*re - std::imag( f )*im;
+}
+inline double __attribute__((always_inline)) realProduct( dcomplex f, dcomplex phase )
+{
+    return realProduct( f, std::real( phase ), std::imag( phase ) );
+}
+
+//! a*b in real arithmetic: unlike operator*, no NaN/infinity recovery call is emitted, so it can be vectorized
+inline dcomplex __attribute__((always_inline)) complexProduct( dcomplex a, dcomplex b )
+{
+    return dcomplex( std::real( a )*std::real( b ) - std::imag( a )*std::imag( b ),
+                     std::real( a )*std::imag( b ) + std::imag( a )*std::real( b ) );
+}
 #endif /* DCOMPLEX_H_ */
@@ -78,14 +78,14 @@ void InterpolatorAM2Order::fields( ElectroMagn *EMfields, Particles &particles,
         Br = ( static_cast<ElectroMagnAM *>( EMfields ) )->Br_m[imode];
         Bt = ( static_cast<ElectroMagnAM *>( EMfields ) )->Bt_m[imode];
 
-        exp_mm_theta *= exp_m_theta_ ;
-
-        *( ELoc+0*nparts ) += std::real( compute( &coeffxd[1], &coeffyp[1], El, idx_d[0], idx_p[1] )* exp_mm_theta ) ;
-        *( ELoc+1*nparts ) += std::real( compute( &coeffxp[1], &coeffyd[1], Er, idx_p[0], idx_d[1] )* exp_mm_theta ) ;
-        *( ELoc+2*nparts ) += std::real( compute( &coeffxp[1], &coeffyp[1], Et, idx_p[0], idx_p[1] )* exp_mm_theta ) ;
-        *( BLoc+0*nparts ) += std::real( compute( &coeffxp[1], &coeffyd[1], Bl, idx_p[0], idx_d[1] )* exp_mm_theta ) ;
-        *( BLoc+1*nparts ) += std::real( compute( &coeffxd[1], &coeffyp[1], Br, idx_d[0], idx_p[1] )* exp_mm_theta ) ;
-        *( BLoc+2*nparts ) += std::real( compute( &coeffxd[1], &coeffyd[1], Bt, idx_d[0], idx_d[1] )* exp_mm_theta ) ;
+        exp_mm_theta = complexProduct( exp_mm_theta, exp_m_theta_ );
+
+        *( ELoc+0*nparts ) += realProduct( compute( &coeffxd[1], &coeffyp[1], El, idx_d[0], idx_p[1] ), exp_mm_theta ) ;
+        *( ELoc+1*nparts ) += realProduct( compute( &coeffxp[1], &coeffyd[1], Er, idx_p[0], idx_d[1] ), exp_mm_theta ) ;
+        *( ELoc+2*nparts ) += realProduct( compute( &coeffxp[1], &coeffyp[1], Et, idx_p[0], idx_p[1] ), exp_mm_theta ) ;
+        *( BLoc+0*nparts ) += realProduct( compute( &coeffxp[1], &coeffyd[1], Bl, idx_p[0], idx_d[1] ), exp_mm_theta ) ;
+        *( BLoc+1*nparts ) += realProduct( compute( &coeffxd[1], &coeffyp[1], Br, idx_d[0], idx_p[1] ), exp_mm_theta ) ;
+        *( BLoc+2*nparts ) += realProduct( compute( &coeffxd[1], &coeffyd[1], Bt, idx_d[0], idx_d[1] ), exp_mm_theta ) ;
     }
 
     //Translate field into the cartesian y,z coordinates
@@ -195,23 +195,23 @@ void InterpolatorAM2Order::fieldsAndCurrents( ElectroMagn *EMfields, Particles &
             Bt_BTIS3 = ( static_cast<ElectroMagnAM *>( EMfields ) )->Bt_mBTIS3[imode];
         }
 
-        exp_mm_theta *= exp_m_theta_ ;
-
-        *( ELoc+0*nparts ) += std::real( compute( &coeffxd[1], &coeffyp[1], El, idx_d[0], idx_p[1] )* exp_mm_theta ) ;
-        *( ELoc+1*nparts ) += std::real( compute( &coeffxp[1], &coeffyd[1], Er, idx_p[0], idx_d[1] )* exp_mm_theta ) ;
-        *( ELoc+2*nparts ) += std::real( compute( &coeffxp[1], &coeffyp[1], Et, idx_p[0], idx_p[1] )* exp_mm_theta ) ;
-        *( BLoc+0*nparts ) += std::real( compute( &coeffxp[1], &coeffyd[1], Bl, idx_p[0], idx_d[1] )* exp_mm_theta ) ;
-        *( BLoc+1*nparts ) += std::real( compute( &coeffxd[1], &coeffyp[1], Br, idx_d[0], idx_p[1] )* exp_mm_theta ) ;
-        *( BLoc+2*nparts ) += std::real( compute( &coeffxd[1], &coeffyd[1], Bt, idx_d[0], idx_d[1] )* exp_mm_theta ) ;
-        JLoc->x += std::real( compute( &coeffxd[1], &coeffyp[1], Jl, idx_d[0], idx_p[1] ) * exp_mm_theta ) ;
-        JLoc->y += std::real( compute( &coeffxp[1], &coeffyd[1], Jr, idx_p[0], idx_d[1] ) * exp_mm_theta ) ;
-        JLoc->z += std::real( compute( &coeffxp[1], &coeffyp[1], Jt, idx_p[0], idx_p[1] ) * exp_mm_theta ) ;
-        ( *RhoLoc ) += std::real( compute( &coeffxp[1], &coeffyp[1], Rho, idx_p[0], idx_p[1] )* exp_mm_theta ) ;
+        exp_mm_theta = complexProduct( exp_mm_theta, exp_m_theta_ );
+
+        *( ELoc+0*nparts ) += realProduct( compute( &coeffxd[1], &coeffyp[1], El, idx_d[0], idx_p[1] ), exp_mm_theta ) ;
+        *( ELoc+1*nparts ) += realProduct( compute( &coeffxp[1], &coeffyd[1], Er, idx_p[0], idx_d[1] ), exp_mm_theta ) ;
+        *( ELoc+2*nparts ) += realProduct( compute( &coeffxp[1], &coeffyp[1], Et, idx_p[0], idx_p[1] ), exp_mm_theta ) ;
+        *( BLoc+0*nparts ) += realProduct( compute( &coeffxp[1], &coeffyd[1], Bl, idx_p[0], idx_d[1] ), exp_mm_theta ) ;
+        *( BLoc+1*nparts ) += realProduct( compute( &coeffxd[1], &coeffyp[1], Br, idx_d[0], idx_p[1] ), exp_mm_theta ) ;
+        *( BLoc+2*nparts ) += realProduct( compute( &coeffxd[1], &coeffyd[1], Bt, idx_d[0], idx_d[1] ), exp_mm_theta ) ;
+        JLoc->x += realProduct( compute( &coeffxd[1], &coeffyp[1], Jl, idx_d[0], idx_p[1] ), exp_mm_theta ) ;
+        JLoc->y += realProduct( compute( &coeffxp[1], &coeffyd[1], Jr, idx_p[0], idx_d[1] ), exp_mm_theta ) ;
+        JLoc->z += realProduct( compute( &coeffxp[1], &coeffyp[1], Jt, idx_p[0], idx_p[1] ), exp_mm_theta ) ;
+        ( *RhoLoc ) += realProduct( compute( &coeffxp[1], &coeffyp[1], Rho, idx_p[0], idx_p[1] ), exp_mm_theta ) ;
         
         if (smpi->use_BTIS3){
             // BTIS3 fields, in the x direction they are centered as Ey and Ez
-            *( BLocyBTIS3+0*nparts ) += std::real( compute( &coeffxp[1], &coeffyp[1], Br_BTIS3, idx_p[0], idx_p[1] )* exp_mm_theta );
-            *( BLoczBTIS3+0*nparts ) += std::real( compute( &coeffxp[1], &coeffyd[1], Bt_BTIS3, idx_p[0], idx_d[1] )* exp_mm_theta );
+            *( BLocyBTIS3+0*nparts ) += realProduct( compute( &coeffxp[1], &coeffyp[1], Br_BTIS3, idx_p[0], idx_p[1] ), exp_mm_theta );
+            *( BLoczBTIS3+0*nparts ) += realProduct( compute( &coeffxp[1], &coeffyd[1], Bt_BTIS3, idx_p[0], idx_d[1] ), exp_mm_theta );
         }
     }
     double delta2 = std::real( exp_m_theta_ ) * *( ELoc+1*nparts ) + std::imag( exp_m_theta_ ) * *( ELoc+2*nparts );
@@ -260,12 +260,12 @@ void InterpolatorAM2Order::oneField( Field **field, Particles &particles, int *i
             cField2D *Jr  = static_cast<cField2D *>( *(field+4*imode+1) );
             cField2D *Jt  = static_cast<cField2D *>( *(field+4*imode+2) );
             cField2D *Rho = static_cast<cField2D *>( *(field+4*imode+3) );
-            Jx_  += std::real( compute( &coeffxd[1], &coeffyp[1], Jl , idx_d[0], idx_p[1] ) * exp_mm_theta );
-            Jy_  += std::real( compute( &coeffxp[1], &coeffyd[1], Jr , idx_p[0], idx_d[1]  ) * exp_mm_theta );
-            Jz_  += std::real( compute( &coeffxp[1], &coeffyp[1], Jt , idx_p[0], idx_p[1] ) * exp_mm_theta );
-            Rho_ += std::real( compute( &coeffxp[1], &coeffyp[1], Rho, idx_p[0], idx_p[1] ) * exp_mm_theta );
+            Jx_  += realProduct( compute( &coeffxd[1], &coeffyp[1], Jl , idx_d[0], idx_p[1] ), exp_mm_theta );
+            Jy_  += realProduct( compute( &coeffxp[1], &coeffyd[1], Jr , idx_p[0], idx_d[1]  ), exp_mm_theta );
+            Jz_  += realProduct( compute( &coeffxp[1], &coeffyp[1], Jt , idx_p[0], idx_p[1] ), exp_mm_theta );
+            Rho_ += realProduct( compute( &coeffxp[1], &coeffyp[1], Rho, idx_p[0], idx_p[1] ), exp_mm_theta );
 
-            exp_mm_theta *= exp_m_theta_;
+            exp_mm_theta = complexProduct( exp_mm_theta, exp_m_theta_ );
         }
         Jxloc [ipart] = Jx_;
         Jyloc [ipart] = std::real( exp_m_theta_ ) * Jy_ + std::imag( exp_m_theta_ ) * Jz_;
@@ -343,14 +343,14 @@ void InterpolatorAM2Order::fieldsWrapper( ElectroMagn *EMfields,
                 Br = ( static_cast<ElectroMagnAM *>( EMfields ) )->Br_m[imode];
                 Bt = ( static_cast<ElectroMagnAM *>( EMfields ) )->Bt_m[imode];
 
-                exp_mm_theta_local *= exp_m_theta_local ;
+                exp_mm_theta_local = complexProduct( exp_mm_theta_local, exp_m_theta_local );
 
-                *( Epart+0*nparts+ipart ) += std::real( compute( &coeffxd[1], &coeffyp[1], El, idx_d[0], idx_p[1] )* exp_mm_theta_local ) ;
-                *( Epart+1*nparts+ipart ) += std::real( compute( &coeffxp[1], &coeffyd[1], Er, idx_p[0], idx_d[1] )* exp_mm_theta_local ) ;
-                *( Epart+2*nparts+ipart ) += std::real( compute( &coeffxp[1], &coeffyp[1], Et, idx_p[0], idx_p[1] )* exp_mm_theta_local ) ;
-                *( Bpart+0*nparts+ipart ) += std::real( compute( &coeffxp[1], &coeffyd[1], Bl, idx_p[0], idx_d[1] )* exp_mm_theta_local ) ;
-                *( Bpart+1*nparts+ipart ) += std::real( compute( &coeffxd[1], &coeffyp[1], Br, idx_d[0], idx_p[1] )* exp_mm_theta_local ) ;
-                *( Bpart+2*nparts+ipart ) += std::real( compute( &coeffxd[1], &coeffyd[1], Bt, idx_d[0], idx_d[1] )* exp_mm_theta_local ) ;
+                *( Epart+0*nparts+ipart ) += realProduct( compute( &coeffxd[1], &coeffyp[1], El, idx_d[0], idx_p[1] ), exp_mm_theta_local ) ;
+                *( Epart+1*nparts+ipart ) += realProduct( compute( &coeffxp[1], &coeffyd[1], Er, idx_p[0], idx_d[1] ), exp_mm_theta_local ) ;
+                *( Epart+2*nparts+ipart ) += realProduct( compute( &coeffxp[1], &coeffyp[1], Et, idx_p[0], idx_p[1] ), exp_mm_theta_local ) ;
+                *( Bpart+0*nparts+ipart ) += realProduct( compute( &coeffxp[1], &coeffyd[1], Bl, idx_p[0], idx_d[1] ), exp_mm_theta_local ) ;
+                *( Bpart+1*nparts+ipart ) += realProduct( compute( &coeffxd[1], &coeffyp[1], Br, idx_d[0], idx_p[1] ), exp_mm_theta_local ) ;
+                *( Bpart+2*nparts+ipart ) += realProduct( compute( &coeffxd[1], &coeffyd[1], Bt, idx_d[0], idx_d[1] ), exp_mm_theta_local ) ;
             }
 
             //Translate field into the cartesian y,z coordinates
@@ -434,17 +434,17 @@ void InterpolatorAM2Order::fieldsWrapper( ElectroMagn *EMfields,
                 Br_BTIS3 = ( static_cast<ElectroMagnAM *>( EMfields ) )->Br_mBTIS3[imode];
                 Bt_BTIS3 = ( static_cast<ElectroMagnAM *>( EMfields ) )->Bt_mBTIS3[imode];
 
-                exp_mm_theta_local *= exp_m_theta_local ;
+                exp_mm_theta_local = complexProduct( exp_mm_theta_local, exp_m_theta_local );
 
-                *( Epart+0*nparts+ipart )      += std::real( compute( &coeffxd[1], &coeffyp[1], El      , idx_d[0], idx_p[1] )* exp_mm_theta_local ) ;
-                *( Epart+1*nparts+ipart )      += std::real( compute( &coeffxp[1], &coeffyd[1], Er      , idx_p[0], idx_d[1] )* exp_mm_theta_local ) ;
-                *( Epart+2*nparts+ipart )      += std::real( compute( &coeffxp[1], &coeffyp[1], Et      , idx_p[0], idx_p[1] )* exp_mm_theta_local ) ;
-                *( Bpart+0*nparts+ipart )      += std::real( compute( &coeffxp[1], &coeffyd[1], Bl      , idx_p[0], idx_d[1] )* exp_mm_theta_local ) ;
-                *( Bpart+1*nparts+ipart )      += std::real( compute( &coeffxd[1], &coeffyp[1], Br      , idx_d[0], idx_p[1] )* exp_mm_theta_local ) ;
-                *( Bpart+2*nparts+ipart )      += std::real( compute( &coeffxd[1], &coeffyd[1], Bt      , idx_d[0], idx_d[1] )* exp_mm_theta_local ) ;
+                *( Epart+0*nparts+ipart )      += realProduct( compute( &coeffxd[1], &coeffyp[1], El      , idx_d[0], idx_p[1] ), exp_mm_theta_local ) ;
+                *( Epart+1*nparts+ipart )      += realProduct( compute( &coeffxp[1], &coeffyd[1], Er      , idx_p[0], idx_d[1] ), exp_mm_theta_local ) ;
+                *( Epart+2*nparts+ipart )      += realProduct( compute( &coeffxp[1], &coeffyp[1], Et      , idx_p[0], idx_p[1] ), exp_mm_theta_local ) ;
+                *( Bpart+0*nparts+ipart )      += realProduct( compute( &coeffxp[1], &coeffyd[1], Bl      , idx_p[0], idx_d[1] ), exp_mm_theta_local ) ;
+                *( Bpart+1*nparts+ipart )      += realProduct( compute( &coeffxd[1], &coeffyp[1], Br      , idx_d[0], idx_p[1] ), exp_mm_theta_local ) ;
+                *( Bpart+2*nparts+ipart )      += realProduct( compute( &coeffxd[1], &coeffyd[1], Bt      , idx_d[0], idx_d[1] ), exp_mm_theta_local ) ;
                 // BTIS3 fields, in the x direction they are centered as Ey and Ez
-                *( BLocyBTIS3+0*nparts+ipart ) += std::real( compute( &coeffxp[1], &coeffyp[1], Br_BTIS3, idx_p[0], idx_p[1] )* exp_mm_theta_local );
-                *( BLoczBTIS3+0*nparts+ipart ) += std::real( compute( &coeffxp[1], &coeffyd[1], Bt_BTIS3, idx_p[0], idx_d[1] )* exp_mm_theta_local );
+                *( BLocyBTIS3+0*nparts+ipart ) += realProduct( compute( &coeffxp[1], &coeffyp[1], Br_BTIS3, idx_p[0], idx_p[1] ), exp_mm_theta_local );
+                *( BLoczBTIS3+0*nparts+ipart ) += realProduct( compute( &coeffxp[1], &coeffyd[1], Bt_BTIS3, idx_p[0], idx_d[1] ), exp_mm_theta_local );
             }
 
             //Translate field into the cartesian y,z coordinates
@@ -575,14 +575,14 @@ void InterpolatorAM2Order::fieldsAndEnvelope( ElectroMagn *EMfields, Particles &
                 Br = ( static_cast<ElectroMagnAM *>( EMfields ) )->Br_m[imode];
                 Bt = ( static_cast<ElectroMagnAM *>( EMfields ) )->Bt_m[imode];
 
-                exp_mm_theta_local *= exp_m_theta_local ;
+                exp_mm_theta_local = complexProduct( exp_mm_theta_local, exp_m_theta_local );
                 
-                ( *Epart ) [ 0*nparts+ipart ] += std::real( compute( &coeffxd[1], &coeffyp[1], El, idx_d[0], idx_p[1] )* exp_mm_theta_local ) ;
-                ( *Epart ) [ 1*nparts+ipart ] += std::real( compute( &coeffxp[1], &coeffyd[1], Er, idx_p[0], idx_d[1] )* exp_mm_theta_local ) ;
-                ( *Epart ) [ 2*nparts+ipart ] += std::real( compute( &coeffxp[1], &coeffyp[1], Et, idx_p[0], idx_p[1] )* exp_mm_theta_local ) ;
-                ( *Bpart ) [ 0*nparts+ipart ] += std::real( compute( &coeffxp[1], &coeffyd[1], Bl, idx_p[0], idx_d[1] )* exp_mm_theta_local ) ;
-                ( *Bpart ) [ 1*nparts+ipart ] += std::real( compute( &coeffxd[1], &coeffyp[1], Br, idx_d[0], idx_p[1] )* exp_mm_theta_local ) ;
-                ( *Bpart ) [ 2*nparts+ipart ] += std::real( compute( &coeffxd[1], &coeffyd[1], Bt, idx_d[0], idx_d[1] )* exp_mm_theta_local ) ;
+                ( *Epart ) [ 0*nparts+ipart ] += realProduct( compute( &coeffxd[1], &coeffyp[1], El, idx_d[0], idx_p[1] ), exp_mm_theta_local ) ;
+                ( *Epart ) [ 1*nparts+ipart ] += realProduct( compute( &coeffxp[1], &coeffyd[1], Er, idx_p[0], idx_d[1] ), exp_mm_theta_local ) ;
+                ( *Epart ) [ 2*nparts+ipart ] += realProduct( compute( &coeffxp[1], &coeffyp[1], Et, idx_p[0], idx_p[1] ), exp_mm_theta_local ) ;
+                ( *Bpart ) [ 0*nparts+ipart ] += realProduct( compute( &coeffxp[1], &coeffyd[1], Bl, idx_p[0], idx_d[1] ), exp_mm_theta_local ) ;
+                ( *Bpart ) [ 1*nparts+ipart ] += realProduct( compute( &coeffxd[1], &coeffyp[1], Br, idx_d[0], idx_p[1] ), exp_mm_theta_local ) ;
+                ( *Bpart ) [ 2*nparts+ipart ] += realProduct( compute( &coeffxd[1], &coeffyd[1], Bt, idx_d[0], idx_d[1] ), exp_mm_theta_local ) ;
             }
 
             // project on x,y,z, remember that GradPhit = 0 in cylindrical symmetry
@@ -681,17 +681,17 @@ void InterpolatorAM2Order::fieldsAndEnvelope( ElectroMagn *EMfields, Particles &
                 Br_BTIS3 = ( static_cast<ElectroMagnAM *>( EMfields ) )->Br_mBTIS3[imode];
                 Bt_BTIS3 = ( static_cast<ElectroMagnAM *>( EMfields ) )->Bt_mBTIS3[imode];
 
-                exp_mm_theta_local *= exp_m_theta_local ;
+                exp_mm_theta_local = complexProduct( exp_mm_theta_local, exp_m_theta_local );
               
-                ( *Epart ) [ 0*nparts+ipart ]    += std::real( compute( &coeffxd[1], &coeffyp[1], El      , idx_d[0], idx_p[1] )* exp_mm_theta_local ) ;
-                ( *Epart ) [ 1*nparts+ipart ]    += std::real( compute( &coeffxp[1], &coeffyd[1], Er      , idx_p[0], idx_d[1] )* exp_mm_theta_local ) ;
-                ( *Epart ) [ 2*nparts+ipart ]    += std::real( compute( &coeffxp[1], &coeffyp[1], Et      , idx_p[0], idx_p[1] )* exp_mm_theta_local ) ;
-                ( *Bpart ) [ 0*nparts+ipart ]    += std::real( compute( &coeffxp[1], &coeffyd[1], Bl      , idx_p[0], idx_d[1] )* exp_mm_theta_local ) ;
-                ( *Bpart ) [ 1*nparts+ipart ]    += std::real( compute( &coeffxd[1], &coeffyp[1], Br      , idx_d[0], idx_p[1] )* exp_mm_theta_local ) ;
-                ( *Bpart ) [ 2*nparts+ipart ]    += std::real( compute( &coeffxd[1], &coeffyd[1], Bt      , idx_d[0], idx_d[1] )* exp_mm_theta_local ) ;
+                ( *Epart ) [ 0*nparts+ipart ]    += realProduct( compute( &coeffxd[1], &coeffyp[1], El      , idx_d[0], idx_p[1] ), exp_mm_theta_local ) ;
+                ( *Epart ) [ 1*nparts+ipart ]    += realProduct( compute( &coeffxp[1], &coeffyd[1], Er      , idx_p[0], idx_d[1] ), exp_mm_theta_local ) ;
+                ( *Epart ) [ 2*nparts+ipart ]    += realProduct( compute( &coeffxp[1], &coeffyp[1], Et      , idx_p[0], idx_p[1] ), exp_mm_theta_local ) ;
+                ( *Bpart ) [ 0*nparts+ipart ]    += realProduct( compute( &coeffxp[1], &coeffyd[1], Bl      , idx_p[0], idx_d[1] ), exp_mm_theta_local ) ;
+                ( *Bpart ) [ 1*nparts+ipart ]    += realProduct( compute( &coeffxd[1], &coeffyp[1], Br      , idx_d[0], idx_p[1] ), exp_mm_theta_local ) ;
+                ( *Bpart ) [ 2*nparts+ipart ]    += realProduct( compute( &coeffxd[1], &coeffyd[1], Bt      , idx_d[0], idx_d[1] ), exp_mm_theta_local ) ;
                 // BTIS3 fields, in the x direction they are centered as Ey and Ez
-                ( *BLocyBTIS3)[ 0*nparts+ipart ] += std::real( compute( &coeffxp[1], &coeffyp[1], Br_BTIS3, idx_p[0], idx_p[1] )* exp_mm_theta_local );
-                ( *BLoczBTIS3)[ 0*nparts+ipart ] += std::real( compute( &coeffxp[1], &coeffyd[1], Bt_BTIS3, idx_p[0], idx_d[1] )* exp_mm_theta_local );
+                ( *BLocyBTIS3)[ 0*nparts+ipart ] += realProduct( compute( &coeffxp[1], &coeffyp[1], Br_BTIS3, idx_p[0], idx_p[1] ), exp_mm_theta_local );
+                ( *BLoczBTIS3)[ 0*nparts+ipart ] += realProduct( compute( &coeffxp[1], &coeffyd[1], Bt_BTIS3, idx_p[0], idx_d[1] ), exp_mm_theta_local );
             }
 
             // project on x,y,z, remember that GradPhit = 0 in cylindrical symmetry
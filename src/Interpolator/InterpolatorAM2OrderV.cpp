@@ -63,7 +63,9 @@ void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
    
     int cell_nparts( ( int )iend[0]-( int )istart[0] );
 
-    std::vector<complex<double>> exp_m_theta_( vecSize), exp_mm_theta( vecSize) ;                                                          //exp(-i theta), exp(-i m theta)
+    // exp(-i theta) and exp(-i m theta) of all modes, computed once per particle in split real/imaginary arrays
+    double exp_m_theta_re[32], exp_m_theta_im[32];
+    std::vector<double> exp_mm_theta_real( nmodes_*vecSize ), exp_mm_theta_imag( nmodes_*vecSize );
 
     //Loop on groups of vecSize particles
     for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
@@ -79,9 +81,11 @@ void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
         
             int ipart2 = ipart+ivect+istart[0];
             double r = sqrt( position_y[ipart2]*position_y[ipart2] + position_z[ipart2]*position_z[ipart2] );
-            exp_m_theta_[ipart] = ( position_y[ipart2] - Icpx * position_z[ipart2] ) / r ;
-            exp_mm_theta[ipart] = 1. ;
-            eitheta_old[ipart] =  2.*std::real(exp_m_theta_[ipart]) - exp_m_theta_[ipart] ;  //exp(i theta)
+            exp_m_theta_re[ipart] =  position_y[ipart2] / r ;
+            exp_m_theta_im[ipart] = -position_z[ipart2] / r ;
+            exp_mm_theta_real[ipart] = 1. ;
+            exp_mm_theta_imag[ipart] = 0. ;
+            eitheta_old[ipart] = std::complex<double>( exp_m_theta_re[ipart], -exp_m_theta_im[ipart] ) ;  //exp(i theta)
 
             // i= 0 ==> X
             //             j=0 primal
@@ -120,7 +124,17 @@ void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
             coeff[1][1][2][ipart]    =  0.5 * ( delta2+delta+0.25 );
         }
 
-        double interp_res;
+        for( unsigned int imode = 1; imode < nmodes_ ; imode++ ) {
+            double * __restrict__ exp_mm_theta_re = &( exp_mm_theta_real[imode*vecSize] );
+            double * __restrict__ exp_mm_theta_im = &( exp_mm_theta_imag[imode*vecSize] );
+            #pragma omp simd
+            for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+                exp_mm_theta_re[ipart] = exp_mm_theta_re[ipart-vecSize] * exp_m_theta_re[ipart] - exp_mm_theta_im[ipart-vecSize] * exp_m_theta_im[ipart];
+                exp_mm_theta_im[ipart] = exp_mm_theta_re[ipart-vecSize] * exp_m_theta_im[ipart] + exp_mm_theta_im[ipart-vecSize] * exp_m_theta_re[ipart];
+            }
+        }
+
+        std::complex<double> interp_res;
         double * __restrict__ coeffld = &( coeff[0][1][1][0] );
         double * __restrict__ coefflp = &( coeff[0][0][1][0] );
         double * __restrict__ coeffrp = &( coeff[1][0][1][0] );
@@ -147,6 +161,8 @@ void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
             cField2D * __restrict__ Bl = ( static_cast<ElectroMagnAM *>( EMfields ) )->Bl_m[imode];
             cField2D * __restrict__ Br = ( static_cast<ElectroMagnAM *>( EMfields ) )->Br_m[imode];
             cField2D * __restrict__ Bt = ( static_cast<ElectroMagnAM *>( EMfields ) )->Bt_m[imode];
+            double * __restrict__ exp_mm_theta_re = &( exp_mm_theta_real[imode*vecSize] );
+            double * __restrict__ exp_mm_theta_im = &( exp_mm_theta_imag[imode*vecSize] );
 
 
 
@@ -167,13 +183,12 @@ void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int iloc=-1 ; iloc<2 ; iloc++ ) {
                     UNROLL_S(3) 
                     for( int jloc=-1 ; jloc<2 ; jloc++ ) {
-                        interp_res += std::real( coeffld[ipart + iloc*32] * coeffrp[ipart + jloc*32] *
+                        interp_res += coeffld[ipart + iloc*32] * coeffrp[ipart + jloc*32] *
                                       ( ( 1.-dual[0][ipart] )*field_buffer[1+iloc][1+jloc] 
-                                           + dual[0][ipart]  *field_buffer[2+iloc][1+jloc] ) 
-                                            * exp_mm_theta[ipart]) ; 
+                                           + dual[0][ipart]  *field_buffer[2+iloc][1+jloc] ); 
                     }
                 }
-                Epart[0][ipart] += interp_res;
+                Epart[0][ipart] += realProduct( interp_res, exp_mm_theta_re[ipart], exp_mm_theta_im[ipart] );
            }
 
            for( int iloc=-1 ; iloc<2 ; iloc++ ) {
@@ -190,13 +205,12 @@ void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                for( int iloc=-1 ; iloc<2 ; iloc++ ) {
                    UNROLL_S(3) 
                    for( int jloc=-1 ; jloc<2 ; jloc++ ) {
-                       interp_res +=  std::real (*( coefflp+ipart+iloc*32 ) * *( coeffrd+ipart+jloc*32 ) *
+                       interp_res +=  *( coefflp+ipart+iloc*32 ) * *( coeffrd+ipart+jloc*32 ) *
                                      ( ( 1-dual[1][ipart] )*field_buffer[1+iloc][1+jloc] 
-                                         + dual[1][ipart]  *field_buffer[1+iloc][2+jloc] )
-                                           * exp_mm_theta[ipart]);
+                                         + dual[1][ipart]  *field_buffer[1+iloc][2+jloc] );
                    }
                }
-               Epart[1][ipart] += interp_res;
+               Epart[1][ipart] += realProduct( interp_res, exp_mm_theta_re[ipart], exp_mm_theta_im[ipart] );
            }
                 
            for( int iloc=-1 ; iloc<2 ; iloc++ ) {
@@ -213,12 +227,11 @@ void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int iloc=-1 ; iloc<2 ; iloc++ ) {
                     UNROLL_S(3) 
                     for( int jloc=-1 ; jloc<2 ; jloc++ ) {
-                        interp_res +=  std::real(  *( coefflp+ipart+iloc*32 ) * *( coeffrp+ipart+jloc*32 ) * 
-                                                    field_buffer[1+iloc][1+jloc]  
-                                                      * exp_mm_theta[ipart]);
+                        interp_res +=  *( coefflp+ipart+iloc*32 ) * *( coeffrp+ipart+jloc*32 ) * 
+                                                    field_buffer[1+iloc][1+jloc];
                     }
                 }
-                Epart[2][ipart] += interp_res;
+                Epart[2][ipart] += realProduct( interp_res, exp_mm_theta_re[ipart], exp_mm_theta_im[ipart] );
            }
                 
            for( int iloc=-1 ; iloc<2 ; iloc++ ) {
@@ -235,13 +248,13 @@ void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int iloc=-1 ; iloc<2 ; iloc++ ) {
                     UNROLL_S(3) 
                     for( int jloc=-1 ; jloc<2 ; jloc++ ) {
-                        interp_res +=  std::real(  *( coefflp+ipart+iloc*32 ) * *( coeffrd+ipart+jloc*32 ) *
+                        interp_res +=  *( coefflp+ipart+iloc*32 ) * *( coeffrd+ipart+jloc*32 ) *
                                       ( ( ( 1-dual[1][ipart] ) * field_buffer[1+iloc][1+jloc] 
                                             + dual[1][ipart]   * field_buffer[1+iloc][2+jloc] )
-                                                )  * exp_mm_theta[ipart] );
+                                                );
                     }
                 }
-                Bpart[0][ipart] += interp_res;
+                Bpart[0][ipart] += realProduct( interp_res, exp_mm_theta_re[ipart], exp_mm_theta_im[ipart] );
            }
                 
            for( int iloc=-1 ; iloc<3 ; iloc++ ) {
@@ -257,13 +270,13 @@ void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int iloc=-1 ; iloc<2 ; iloc++ ) {
                     UNROLL_S(3) 
                     for( int jloc=-1 ; jloc<2 ; jloc++ ) {
-                        interp_res +=  std::real(  *( coeffld+ipart+iloc*32 ) * *( coeffrp+ipart+jloc*32 ) *
+                        interp_res +=  *( coeffld+ipart+iloc*32 ) * *( coeffrp+ipart+jloc*32 ) *
                                       ( ( ( 1-dual[0][ipart] )* field_buffer[ 1+iloc][1+jloc ] 
                                             + dual[0][ipart]  * field_buffer[ 2+iloc][1+jloc ] )
-                                                )  * exp_mm_theta[ipart]);
+                                                );
                     }
                 }
-                Bpart[1][ipart] += interp_res;
+                Bpart[1][ipart] += realProduct( interp_res, exp_mm_theta_re[ipart], exp_mm_theta_im[ipart] );
            }
                 
            for( int iloc=-1 ; iloc<3 ; iloc++ ) {
@@ -279,27 +292,26 @@ void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 for( int iloc=-1 ; iloc<2 ; iloc++ ) {
                     UNROLL_S(3) 
                     for( int jloc=-1 ; jloc<2 ; jloc++ ) {
-                        interp_res +=  std::real(  *( coeffld+ipart+iloc*32 ) * *( coeffrd+ipart+jloc*32 ) *
+                        interp_res +=  *( coeffld+ipart+iloc*32 ) * *( coeffrd+ipart+jloc*32 ) *
                                       ( ( 1-dual[1][ipart] ) * ( ( 1-dual[0][ipart] )*field_buffer[1+iloc][1+jloc] 
                                                                      + dual[0][ipart]*field_buffer[2+iloc][1+jloc] )
                                         +    dual[1][ipart]  * ( ( 1-dual[0][ipart] )*field_buffer[1+iloc][2+jloc] 
                                                                      + dual[0][ipart]*field_buffer[2+iloc][2+jloc] )
-                                                ) * exp_mm_theta[ipart] );
+                                                );
                     }
                 }
-                Bpart[2][ipart] += interp_res;
-                exp_mm_theta[ipart] *= exp_m_theta_[ipart]; //prepare for next mode
+                Bpart[2][ipart] += realProduct( interp_res, exp_mm_theta_re[ipart], exp_mm_theta_im[ipart] );
            }
        } //end loop on modes
 
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
             //Translate field into the cartesian y,z coordinates
-            double delta2 = std::real( exp_m_theta_[ipart] ) * Epart[1][ipart] + std::imag( exp_m_theta_[ipart] ) * Epart[2][ipart];
-            Epart[2][ipart] = -std::imag( exp_m_theta_[ipart] ) * Epart[1][ipart] + std::real( exp_m_theta_[ipart] ) * Epart[2][ipart];
+            double delta2 = exp_m_theta_re[ipart] * Epart[1][ipart] + exp_m_theta_im[ipart] * Epart[2][ipart];
+            Epart[2][ipart] = -exp_m_theta_im[ipart] * Epart[1][ipart] + exp_m_theta_re[ipart] * Epart[2][ipart];
             Epart[1][ipart] = delta2 ;
-            delta2 = std::real( exp_m_theta_[ipart] ) * Bpart[1][ipart] + std::imag( exp_m_theta_[ipart] ) * Bpart[2][ipart];
-            Bpart[2][ipart] = -std::imag( exp_m_theta_[ipart] ) * Bpart[1][ipart] + std::real( exp_m_theta_[ipart] ) * Bpart[2][ipart];
+            delta2 = exp_m_theta_re[ipart] * Bpart[1][ipart] + exp_m_theta_im[ipart] * Bpart[2][ipart];
+            Bpart[2][ipart] = -exp_m_theta_im[ipart] * Bpart[1][ipart] + exp_m_theta_re[ipart] * Bpart[2][ipart];
             Bpart[1][ipart] = delta2 ;
         }
 
@@ -32,3 +32,39 @@ Merging::Merging( Species *species, Random * rand )
 Merging::~Merging()
 {
 }
+
+// -----------------------------------------------------------------------------
+//! Merge the particles of the contiguous range [istart, iend)
+// -----------------------------------------------------------------------------
+void Merging::operator()(
+        double mass,
+        Particles &particles,
+        std::vector <int> &mask,
+        int istart,
+        int iend,
+        int & count)
+{
+    const unsigned int number_of_particles = (unsigned int)(iend - istart);
+
+    if (number_of_particles > min_particles_per_cell_) {
+        unsigned int * particle_index = MergingBuffers::reserve( threadBuffers().particle_index, number_of_particles );
+        for( unsigned int ipr = 0 ; ipr < number_of_particles ; ipr++ ) {
+            particle_index[ipr] = istart + ipr;
+        }
+        merge( mass, particles, mask, particle_index, number_of_particles, count );
+    }
+}
+
+// -----------------------------------------------------------------------------
+//! Scratch arrays of the calling thread.
+//! The pool is created once with one entry per OpenMP thread.
+// -----------------------------------------------------------------------------
+MergingBuffers & Merging::threadBuffers()
+{
+#ifdef _OPENMP
+    static std::vector<MergingBuffers> pool( std::max( omp_get_max_threads(), omp_get_num_threads() ) );
+#else
+    static std::vector<MergingBuffers> pool( 1 );
+#endif
+    return pool[Tools::getOMPThreadNum()];
+}
@@ -11,11 +11,67 @@
 #ifndef MERGING_H
 #define MERGING_H
 
+#include <algorithm>
+#include <vector>
+
 #include "Params.h"
 #include "Particles.h"
 #include "Species.h"
 #include "Random.h"
 
+//  ----------------------------------------------------------------------------
+//! Scratch arrays used by the merging process.
+//! One instance exists per OpenMP thread (see Merging::threadBuffers).
+//! The arrays grow to the largest cell ever merged by the thread and are
+//! never shrunk, so that no allocation occurs in the steady state.
+//  ----------------------------------------------------------------------------
+struct MergingBuffers
+{
+    //! Particle index of each particle of the cell
+    std::vector <unsigned int> particle_index;
+    //! Momentum cell index of each particle of the cell
+    std::vector <unsigned int> momentum_cell_index;
+    //! Particle (relative) indexes sorted by momentum cell
+    std::vector <unsigned int> sorted_particles;
+    //! Number of particles per momentum cell
+    std::vector <unsigned int> particles_per_momentum_cells;
+    //! First particle of each momentum cell in sorted_particles
+    std::vector <unsigned int> momentum_cell_particle_index;
+    //! Gamma factor (Cartesian) or momentum norm (spherical) of each particle
+    std::vector <double> gamma;
+    //! Spherical angles of each particle
+    std::vector <double> particles_phi;
+    std::vector <double> particles_theta;
+    //! Spherical discretization per phi value
+    std::vector <unsigned int> theta_dim;
+    std::vector <unsigned int> theta_start_index;
+    std::vector <double> theta_min;
+    std::vector <double> theta_max;
+    std::vector <double> theta_delta;
+    std::vector <double> inv_theta_delta;
+    //! Direction of each angular momentum cell
+    std::vector <double> cell_vec_x;
+    std::vector <double> cell_vec_y;
+    std::vector <double> cell_vec_z;
+    //! Mask of the removed particles for the whole species
+    std::vector <int> mask;
+    //! Spatial cell key of each particle and particle count per spatial cell
+    //! (used by species that are not sorted per cell)
+    std::vector <int> cell_keys;
+    std::vector <unsigned int> cell_count;
+    std::vector <unsigned int> cell_sorted_particles;
+
+    //! Make sure `buffer` can hold at least `size` elements
+    template <typename T>
+    static inline T * reserve( std::vector <T> &buffer, unsigned int size )
+    {
+        if( buffer.size() < size ) {
+            buffer.resize( size );
+        }
+        return buffer.data();
+    }
+};
+
 //  ----------------------------------------------------------------------------
 //! Class Merging
 //  ----------------------------------------------------------------------------
@@ -28,32 +84,97 @@ public:
 
     virtual ~Merging();
 
-    //! Overloading of () operator
+    //! Overloading of () operator: merge the particles of a contiguous range
     //! \param particles   particle object containing the particle
     //!                    properties of the current species
-    //! \param smpi        MPI properties
+    //! \param mask        set to -1 for the removed particles
     //! \param istart      Index of the first particle
     //! \param iend        Index of the last particle
-    virtual void operator()(
+    //! \param count       Final number of particles
+    void operator()(
         double mass,
         Particles &particles,
         std::vector <int> &mask,
         int istart,
         int iend,
+        int & count);
+
+    //! Merge the particles listed in `particle_index` (all in the same cell)
+    //! \param particles   particle object containing the particle
+    //!                    properties of the current species
+    //! \param mask        set to -1 for the removed particles
+    //! \param particle_index indexes of the particles of the cell
+    //! \param number_of_particles number of particles of the cell
+    //! \param count       Final number of particles
+    virtual void merge(
+        double mass,
+        Particles &particles,
+        std::vector <int> &mask,
+        const unsigned int * particle_index,
+        unsigned int number_of_particles,
         int & count) = 0;
 
+    //! Scratch arrays of the calling thread
+    static MergingBuffers & threadBuffers();
+
     // parameters _______________________________________________
 
 protected:
-    
+
+    //! Merge the packets of the momentum cells [ic_start, ic_end) by calling
+    //! `mergeMomentumCell( ic )` which returns the number of removed particles.
+    //! When the cell holds more than `parallel_threshold_` particles
+    //! and other threads are available, the momentum cells are distributed
+    //! over OpenMP tasks. Only `count` is shared between momentum cells.
+    template <typename MergeMomentumCell>
+    void mergeMomentumCells( unsigned int number_of_particles,
+                             unsigned int momentum_cells,
+                             int & count,
+                             MergeMomentumCell mergeMomentumCell );
+
     // Local rand generator
     Random * rand_;
     
     // Minimum number of particles per cell to process the merging
     unsigned int min_particles_per_cell_;
+
+    // Number of particles in a cell above which its momentum cells are merged in parallel
+    static const unsigned int parallel_threshold_ = 4096;
     
 private:
     
 };
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+template <typename MergeMomentumCell>
+void Merging::mergeMomentumCells( unsigned int number_of_particles,
+                                  unsigned int momentum_cells,
+                                  int & count,
+                                  MergeMomentumCell mergeMomentumCell )
+{
+#ifdef _OPENMP
+    const int nthreads = omp_get_num_threads();
+    if( number_of_particles >= parallel_threshold_ && nthreads > 1 && momentum_cells > 1 ) {
+        const unsigned int grain = std::max( 1u, momentum_cells / ( 4*nthreads ) );
+        int removed = 0;
+        #pragma omp taskloop default(shared) grainsize(grain)
+        for( unsigned int ic = 0 ; ic < momentum_cells ; ic++ ) {
+            int removed_ic = mergeMomentumCell( ic );
+            if( removed_ic > 0 ) {
+                #pragma omp atomic
+                removed += removed_ic;
+            }
+        }
+        count -= removed;
+        return;
+    }
+#endif
+    for( unsigned int ic = 0 ; ic < momentum_cells ; ic++ ) {
+        count -= mergeMomentumCell( ic );
+    }
+}
+
 #endif
@@ -56,26 +56,24 @@ MergingVranicCartesian::~MergingVranicCartesian()
 
 
 // ---------------------------------------------------------------------
-//! Overloading of () operator: perform the Vranic particle merging
+//! Perform the Vranic particle merging in a cell
 //! \param particles   particle object containing the particle
 //!                    properties
-//! \param istart      Index of the first particle
-//! \param iend        Index of the last particle
+//! \param particle_index indexes of the particles of the cell
+//! \param number_of_particles number of particles of the cell
 //! \param count       Final number of particles
 // ---------------------------------------------------------------------
-void MergingVranicCartesian::operator() (
+void MergingVranicCartesian::merge(
         double mass,
         Particles &particles,
         std::vector <int> &mask,
-        int istart,
-        int iend,
+        const unsigned int * particle_index,
+        unsigned int number_of_particles,
         int & count)
         //unsigned int &remaining_particles,
         //unsigned int &merged_particles)
 {
 
-    unsigned int number_of_particles = (unsigned int)(iend - istart);
-
     // First of all, we check that there is enought particles per cell
     // to process the merging.
     if (number_of_particles > min_particles_per_cell_) {
@@ -98,11 +96,6 @@ void MergingVranicCartesian::operator() (
         // Inverse Delta
         double inv_momentum_delta[3];
 
-        // Angles
-        // double omega;
-        double cos_omega;
-        double sin_omega;
-
         // Index in each direction
         unsigned int mx_i;
         unsigned int my_i;
@@ -110,32 +103,8 @@ void MergingVranicCartesian::operator() (
 
         // Local particle index
         unsigned int ic;
-        unsigned int icc;
-        unsigned int ipack;
-        unsigned int npack;
         unsigned int ip;
-        unsigned int ipr, ipr_min, ipr_max;
-
-        // Total weight for merging process
-        double total_weight;
-        double total_momentum_x;
-        double total_momentum_y;
-        double total_momentum_z;
-        double total_momentum_norm;
-        double total_energy;
-
-        // New particle properties
-        double new_energy;
-        double new_momentum_norm;
-        double e1_x,e1_y,e1_z;
-        double e3_x,e3_y,e3_z;
-        double e2_x,e2_y,e2_z;
-        double e2_norm;
-
-        // Momentum cell directions
-        double cell_vec_x;
-        double cell_vec_y;
-        double cell_vec_z;
+        unsigned int ipr;
 
         // Momentum shortcut
         // double * momentum[3];
@@ -153,29 +122,25 @@ void MergingVranicCartesian::operator() (
         // Cell keys shortcut
         // int *cell_keys = &( particles.cell_keys[0] );
 
+        // Scratch arrays of this thread
+        MergingBuffers & buffers = threadBuffers();
+
         // Local vector to store the momentum index in the momentum discretization
-        // std::vector <unsigned int> momentum_cell_index(number_of_particles,0);
-        // unsigned int  * momentum_cell_index = (unsigned int*) aligned_alloc(64, number_of_particles*sizeof(unsigned int));
-        unsigned int  * momentum_cell_index = new unsigned int [number_of_particles];
+        unsigned int  * momentum_cell_index = MergingBuffers::reserve( buffers.momentum_cell_index, number_of_particles );
 
-        // Sorted array of particle index
-        // std::vector <unsigned int> sorted_particles(number_of_particles,0);
-        // unsigned int  * sorted_particles = (unsigned int*) aligned_alloc(64, number_of_particles*sizeof(unsigned int));
-        unsigned int  * sorted_particles = new unsigned int [number_of_particles];
+        // Sorted array of (relative) particle index
+        unsigned int  * sorted_particles = MergingBuffers::reserve( buffers.sorted_particles, number_of_particles );
 
         // Particle gamma factor
-        // std::vector <double> gamma(number_of_particles,0);
-        // double  * gamma = (double*) aligned_alloc(64, number_of_particles*sizeof(double));
-        double  * gamma = new double [number_of_particles];
+        double  * gamma = MergingBuffers::reserve( buffers.gamma, number_of_particles );
 
         // Computation of the particle gamma factor
         if (mass == 0) {
-            #pragma omp simd private(ipr) 
-            //aligned(gamma : 64)
-            for (ip=(unsigned int)(istart) ; ip<(unsigned int) (iend); ip++ ) {
+            #pragma omp simd private(ip)
+            for (ipr=0 ; ipr<number_of_particles; ipr++ ) {
 
-                // Local (relative) array index
-                ipr = ip - istart;
+                // Particle array index
+                ip = particle_index[ipr];
 
                 gamma[ipr] = sqrt(momentum_x[ip]*momentum_x[ip]
                               + momentum_y[ip]*momentum_y[ip]
@@ -183,12 +148,11 @@ void MergingVranicCartesian::operator() (
 
             }
         } else {
-            #pragma omp simd private(ipr) 
-            //aligned(gamma : 64)
-            for (ip=(unsigned int)(istart) ; ip<(unsigned int) (iend); ip++ ) {
+            #pragma omp simd private(ip)
+            for (ipr=0 ; ipr<number_of_particles; ipr++ ) {
 
-                // Local (relative) array index
-                ipr = ip - istart;
+                // Particle array index
+                ip = particle_index[ipr];
 
                 gamma[ipr] = sqrt(1.0 + momentum_x[ip]*momentum_x[ip]
                               + momentum_y[ip]*momentum_y[ip]
@@ -198,21 +162,22 @@ void MergingVranicCartesian::operator() (
         }
 
         // Computation of the maxima and minima for each direction
-        momentum_min[0] = momentum_x[istart];
-        momentum_max[0] = momentum_x[istart];
+        momentum_min[0] = momentum_x[particle_index[0]];
+        momentum_max[0] = momentum_x[particle_index[0]];
 
-        momentum_min[1] = momentum_y[istart];
-        momentum_max[1] = momentum_y[istart];
+        momentum_min[1] = momentum_y[particle_index[0]];
+        momentum_max[1] = momentum_y[particle_index[0]];
 
-        momentum_min[2] = momentum_z[istart];
-        momentum_max[2] = momentum_z[istart];
+        momentum_min[2] = momentum_z[particle_index[0]];
+        momentum_max[2] = momentum_z[particle_index[0]];
 
 #if __INTEL_COMPILER > 18000
         #pragma omp simd \
         reduction(min:momentum_min)  \
         reduction(max:momentum_max)
 #endif
-        for (ip=(unsigned int) (istart) ; ip < (unsigned int) (iend); ip++ ) {
+        for (ipr=0 ; ipr < number_of_particles; ipr++ ) {
+            ip = particle_index[ipr];
             momentum_min[0] = std::min(momentum_min[0],momentum_x[ip]);
             momentum_max[0] = std::max(momentum_max[0],momentum_x[ip]);
 
@@ -388,17 +353,13 @@ void MergingVranicCartesian::operator() (
                                     * dim[2];
 
         // Array containing the number of particles per momentum cells
-        // std::vector <unsigned int> particles_per_momentum_cells(momentum_cells,0);
-        // unsigned int  * particles_per_momentum_cells = (unsigned int*) aligned_alloc(64, momentum_cells*sizeof(unsigned int));
-        unsigned int  * particles_per_momentum_cells = new unsigned int [momentum_cells];
-        
+        unsigned int  * particles_per_momentum_cells = MergingBuffers::reserve( buffers.particles_per_momentum_cells, momentum_cells );
+
         // Array containing the first particle index of each momentum cell
         // in the sorted particle array
-        //std::vector <unsigned int> momentum_cell_particle_index(momentum_cells,0);
-        // unsigned int  * momentum_cell_particle_index = (unsigned int*) aligned_alloc(64, momentum_cells*sizeof(unsigned int));
-        unsigned int  * momentum_cell_particle_index = new unsigned int [momentum_cells];
-        
-        // Initialization when using aligned_alloc
+        unsigned int  * momentum_cell_particle_index = MergingBuffers::reserve( buffers.momentum_cell_particle_index, momentum_cells );
+
+        // Initialization of the reused arrays
         #pragma omp simd
         for (ic = 0 ; ic < momentum_cells ; ic++) {
             momentum_cell_particle_index[ic] = 0;
@@ -409,12 +370,11 @@ void MergingVranicCartesian::operator() (
         // requested discretization.
         // This loop can be efficiently vectorized
         #pragma omp simd \
-        private(ipr,mx_i,my_i,mz_i) 
-        //aligned(momentum_cell_index: 64)
-        for (ip=(unsigned int) (istart) ; ip < (unsigned int) (iend); ip++ ) {
+        private(ip,mx_i,my_i,mz_i)
+        for (ipr=0 ; ipr < number_of_particles; ipr++ ) {
 
-            // Relative particle array index
-            ipr = ip - istart;
+            // Particle array index
+            ip = particle_index[ipr];
 
             // 3d indexes in the momentum discretization
             mx_i = (unsigned int) floor( (momentum_x[ip] - momentum_min[0]) * inv_momentum_delta[0]);
@@ -503,7 +463,7 @@ void MergingVranicCartesian::operator() (
             // }
 
             sorted_particles[momentum_cell_particle_index[ic]
-            + particles_per_momentum_cells[ic]] = istart + ipr;
+            + particles_per_momentum_cells[ic]] = ipr;
 
             particles_per_momentum_cells[ic] += 1;
         }
@@ -512,328 +472,187 @@ void MergingVranicCartesian::operator() (
         // For each momentum bin, merge packet of particles composed of
         // at least `min_packet_size_` and `max_packet_size_`
 
-        // Loop over the the momentum cells that have enough particles
-        for (mz_i=0 ; mz_i< dim[2]; mz_i++ ) {
+        // Merge the packets of a momentum cell and return the number of
+        // removed particles. Momentum cells are independent from each other
+        // so that they can be processed in any order or in parallel.
+        auto mergeMomentumCell = [&]( unsigned int ic ) -> int {
 
-            cell_vec_z = momentum_min[2] + (mz_i+0.5)*momentum_delta[2];
+            // Check if there is enought particles in the momentum
+            // cell to trigger the merging procecc
+            if (particles_per_momentum_cells[ic] < min_packet_size_ ) {
+                return 0;
+            }
 
-            for (my_i=0 ; my_i< dim[1]; my_i++ ) {
+            int removed = 0;
 
-                cell_vec_y = momentum_min[1] + (my_i+0.5)*momentum_delta[1];
+            // 3d indexes of the momentum cell
+            const unsigned int imx = ic % dim[0];
+            const unsigned int imy = (ic / dim[0]) % dim[1];
+            const unsigned int imz = ic / (dim[0]*dim[1]);
 
-                // 1D cell direction index
-                icc = my_i + mz_i* dim[1] ;
+            // Momentum cell directions
+            const double cell_vec_x = momentum_min[0] + (imx+0.5)*momentum_delta[0];
+            const double cell_vec_y = momentum_min[1] + (imy+0.5)*momentum_delta[1];
+            const double cell_vec_z = momentum_min[2] + (imz+0.5)*momentum_delta[2];
 
-                for (mx_i=0 ; mx_i< dim[0]; mx_i++ ) {
+            // Sorted (relative) particle indexes of this momentum cell
+            const unsigned int * cell_particles = &sorted_particles[momentum_cell_particle_index[ic]];
 
-                    cell_vec_x = momentum_min[0] + (mx_i+0.5)*momentum_delta[0];
+            // Computation of the number of particle packets to merge
+            unsigned int npack = particles_per_momentum_cells[ic]/max_packet_size_;
 
-                    // 1D cell index
-                    ic = mx_i + icc*dim[0];
+            // Check if the rest is sufficient to add an additional smaller packet
+            if (particles_per_momentum_cells[ic]%max_packet_size_ >= min_packet_size_) {
+                npack += 1;
+            }
 
-                    // Check if there is enought particles in the momentum
-                    // cell to trigger the merging procecc
-                    if (particles_per_momentum_cells[ic] >= min_packet_size_ ) {
+            // Loop over the packets of particles that can be merged
+            for (unsigned int ipack = 0 ; ipack < npack ; ipack += 1) {
 
-                        // Computation of the number of particle packets to merge
-                        npack = particles_per_momentum_cells[ic]/max_packet_size_;
+                double total_weight = 0;
+                double total_momentum_x = 0;
+                double total_momentum_y = 0;
+                double total_momentum_z = 0;
+                double total_energy = 0;
 
-                        // Check if the rest is sufficient to add an additional smaller packet
-                        if (particles_per_momentum_cells[ic]%max_packet_size_ >= min_packet_size_) {
-                            npack += 1;
-                        }
+                // First index of the packet
+                const unsigned int ipr_min = ipack*max_packet_size_;
+                // last index of the packet
+                const unsigned int ipr_max = std::min((ipack+1)*max_packet_size_,particles_per_momentum_cells[ic]);
 
-                        // Loop over the packets of particles that can be merged
-                        for (ipack = 0 ; ipack < npack ; ipack += 1) {
-
-                            total_weight = 0;
-                            total_momentum_x = 0;
-                            total_momentum_y = 0;
-                            total_momentum_z = 0;
-                            total_energy = 0;
-
-                            // First index of the packet
-                            ipr_min = ipack*max_packet_size_;
-                            // last index of the packet
-                            ipr_max = std::min((ipack+1)*max_packet_size_,particles_per_momentum_cells[ic]);
-
-                            // _______________________________________________________________
-
-                            // Compute total weight, total momentum and total energy
-
-                            for (ipr = ipr_min ; ipr < ipr_max ; ipr ++) {
-
-                                // Particle index in Particles
-                                ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-
-                                // Total weight (wt)
-                                total_weight += weight[ip];
-
-                                // total momentum vector (pt)
-                                total_momentum_x += momentum_x[ip]*weight[ip];
-                                total_momentum_y += momentum_y[ip]*weight[ip];
-                                total_momentum_z += momentum_z[ip]*weight[ip];
-
-                                // total energy
-                                total_energy += weight[ip]*gamma[ip - istart];
-
-                            }
-
-                            // \varepsilon_a in Vranic et al
-                            new_energy = total_energy / total_weight;
-
-                            // pa in Vranic et al.
-                            // For photons
-                            if (mass == 0) {
-                                new_momentum_norm = new_energy;
-                            // For mass particles
-                            } else {
-                                new_momentum_norm = sqrt(new_energy*new_energy - 1.0);
-                            }
-
-                            // Total momentum norm
-                            total_momentum_norm = sqrt(total_momentum_x*total_momentum_x
-                                                +      total_momentum_y*total_momentum_y
-                                                +      total_momentum_z*total_momentum_z);
-
-                            // Angle between pa and pt, pb and pt in Vranic et al.
-                            cos_omega = std::min(total_momentum_norm / (total_weight*new_momentum_norm),1.0);
-                            sin_omega = sqrt(1 - cos_omega*cos_omega);
-
-                            // Now, represents the inverse to avoid useless division
-                            total_momentum_norm = 1/total_momentum_norm;
-
-                            // Computation of e1 unit vector
-                            e1_x = total_momentum_x*total_momentum_norm;
-                            e1_y = total_momentum_y*total_momentum_norm;
-                            e1_z = total_momentum_z*total_momentum_norm;
-
-                            // e3 = e1 x cell_vec
-                            e3_x = e1_y*cell_vec_z - e1_z*cell_vec_y;
-                            e3_y = e1_z*cell_vec_x - e1_x*cell_vec_z;
-                            e3_z = e1_x*cell_vec_y - e1_y*cell_vec_x;
-
-                            // All particle momenta are not collinear
-                            if (fabs(e3_x*e3_x + e3_y*e3_y + e3_z*e3_z) > 0)
-                            {
-
-                                // Computation of e2  = e1 x e3 unit vector
-                                // e2_x = e1_y*e1_y*cell_vec_x
-                                //      - e1_x * (e1_y*cell_vec_y + e1_z*cell_vec_z)
-                                //      + e1_z*e1_z*cell_vec_x;
-                                // e2_y = e1_z*e1_z*cell_vec_y
-                                //      - e1_y * (e1_z*cell_vec_z + e1_x*cell_vec_x)
-                                //      + e1_x*e1_x*cell_vec_y;
-                                // e2_z = e1_x*e1_x*cell_vec_z
-                                //      - e1_z * (e1_x*cell_vec_x + e1_y*cell_vec_y)
-                                //      + e1_y*e1_y*cell_vec_z;
-
-                                e2_x = e1_y*e3_z - e1_z*e3_y;
-                                e2_y = e1_z*e3_x - e1_x*e3_z;
-                                e2_z = e1_x*e3_y - e1_y*e3_x;
-
-                                e2_norm = 1./sqrt(e2_x*e2_x + e2_y*e2_y + e2_z*e2_z);
-
-                                // e2 is normalized to be a unit vector
-                                e2_x = e2_x * e2_norm;
-                                e2_y = e2_y * e2_norm;
-                                e2_z = e2_z * e2_norm;
-
-                                // double mx1 = new_momentum_norm*(cos_omega*e1_x + sin_omega*e2_x);
-                                // double mx2 = new_momentum_norm*(cos_omega*e1_x - sin_omega*e2_x);
-                                // total_momentum_y = new_momentum_norm*(cos_omega*e1_y + sin_omega*e2_y);
-                                // double my2 = new_momentum_norm*(cos_omega*e1_y - sin_omega*e2_y);
-                                // total_momentum_z = new_momentum_norm*(cos_omega*e1_z + sin_omega*e2_z);
-                                // double mz2 = new_momentum_norm*(cos_omega*e1_z - sin_omega*e2_z);
-                                // if (std::isnan(total_momentum_x)
-                                //     || std::isnan(total_momentum_y)
-                                //     || std::isnan(total_momentum_z)
-                                //     // || mx1 < momentum_min[0] + mx_i*momentum_delta[0]
-                                //     // || total_momentum_y < momentum_min[1] + my_i*momentum_delta[1]
-                                //     // || total_momentum_z < momentum_min[2] + mz_i*momentum_delta[2]
-                                //     // || mx1 > momentum_min[0] + (mx_i+1)*momentum_delta[0]
-                                //     // || total_momentum_y > momentum_min[1] + (my_i+1)*momentum_delta[1]
-                                //     // || total_momentum_z > momentum_min[2] + (mz_i+1)*momentum_delta[2]
-                                //     // || fabs(new_energy - sqrt(mx1*mx1
-                                //     //                   + total_momentum_y*total_momentum_y
-                                //     //                   + total_momentum_z*total_momentum_z)) > 1e-7
-                                //     ) {
-                                //
-                                //     for (ipr = ipr_min; ipr < ipr_max ; ipr ++) {
-                                //         ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                                //         std::cerr
-                                //         << " mx: " << momentum_x[ip]
-                                //         << " my: " << momentum_y[ip]
-                                //         << " mz: " << momentum_z[ip]
-                                //         << std::endl;
-                                //     }
-                                //
-                                //     ip = sorted_particles[momentum_cell_particle_index[ic] + ipr_min];
-                                //
-                                //     //std::cerr <<
-                                //     ERROR(std::scientific << std::setprecision(15)
-                                //       << " dim: " << dim[0] << " " << dim[1] << " " << dim[2] << "\n"
-                                //       << " mx1: " << mx1
-                                //       << " mx2: " << mx2
-                                //       << " mx[i]: " << momentum_min[0] + mx_i*momentum_delta[0]
-                                //       << " mx[i+1]: " << momentum_min[0] + (mx_i+1)*momentum_delta[0]
-                                //       << " momentum_delta[0]: " << momentum_delta[0]
-                                //       << "\n"
-                                //       << " my1: " << total_momentum_y
-                                //       << " my2: " << my2
-                                //       << " my[i]: " << momentum_min[1] + my_i*momentum_delta[1]
-                                //       << " my[i+1]: " << momentum_min[1] + (my_i+1)*momentum_delta[1] << "\n"
-                                //       << " mz: " << total_momentum_z
-                                //       << " mz2: " << mz2
-                                //       << " mz[i]: " << momentum_min[2] + mz_i*momentum_delta[2]
-                                //       << " mz[i+1]: " << momentum_min[2] + (mz_i+1)*momentum_delta[2] << "\n"
-                                //       << " total_weight: " << 0.5*total_weight
-                                //       << " energy: " << total_energy / total_weight
-                                //       << " energy: " << sqrt(mx1*mx1
-                                //                         + total_momentum_y*total_momentum_y
-                                //                         + total_momentum_z*total_momentum_z)
-                                //       << " " << fabs(new_energy - sqrt(total_momentum_x*total_momentum_x
-                                //                         + total_momentum_y*total_momentum_y
-                                //                         + total_momentum_z*total_momentum_z)) << "\n"
-                                //       << " total energy: " << 0.5*total_energy
-                                //       << " total energy: " << 0.5*total_weight*sqrt(mx1*mx1
-                                //                         + total_momentum_y*total_momentum_y
-                                //                         + total_momentum_z*total_momentum_z)
-                                //       << " " << fabs(total_energy - total_weight*sqrt(mx1*mx1
-                                //                         + total_momentum_y*total_momentum_y
-                                //                         + total_momentum_z*total_momentum_z)) << "\n"
-                                //     << " omega: " << std::acos(std::min(total_momentum_norm / (total_weight*new_momentum_norm),1.0))
-                                //     << " " << total_momentum_norm / (total_weight*new_momentum_norm)
-                                //     << " cos_omega: " << cos_omega << " sin_omega: " << sin_omega << "\n"
-                                //     << " cell_vec: " << cell_vec_x << " " << cell_vec_y << " " << cell_vec_z << "\n"
-                                //     << " e1: " << e1_x << " " << e1_y << " " << e1_z << "\n"
-                                //     << " e3: " << e3_x << " " << e3_y << " " << e3_z << "\n"
-                                //     << " e2: " << e2_x << " " << e2_y << " " << e2_z << "\n"
-                                //     << " e1.e2: " << e1_x*e2_x + e1_y*e2_y + e1_z*e2_z
-                                //     )
-                                //     //<< std::endl;
-                                // }
-
-                                // Create the merged particles
-                                // --------------------------------------------
-
-                                // Method 1: determinist - use the position of
-                                // the first particles of the list
-
-                                // Update momentum of the first photon
-                                ip = sorted_particles[momentum_cell_particle_index[ic] + ipr_min];
-
-                                momentum_x[ip] = new_momentum_norm*(cos_omega*e1_x + sin_omega*e2_x);
-                                momentum_y[ip] = new_momentum_norm*(cos_omega*e1_y + sin_omega*e2_y);
-                                momentum_z[ip] = new_momentum_norm*(cos_omega*e1_z + sin_omega*e2_z);
-                                weight[ip] = 0.5*total_weight;
-
-                                // Update momentum of the second particle
-                                ip = sorted_particles[momentum_cell_particle_index[ic] + ipr_min + 1];
-                                momentum_x[ip] = new_momentum_norm*(cos_omega*e1_x - sin_omega*e2_x);
-                                momentum_y[ip] = new_momentum_norm*(cos_omega*e1_y - sin_omega*e2_y);
-                                momentum_z[ip] = new_momentum_norm*(cos_omega*e1_z - sin_omega*e2_z);
-                                weight[ip] = 0.5*total_weight;
-
-                                // Other photons are tagged to be removed after
-                                for (ipr = ipr_min + 2; ipr < ipr_max ; ipr ++) {
-                                    ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                                    mask[ip] = -1;
-                                    count--;
-                                }
-
-                                // Method 2: random - pick up randomly old particle positions
-
-                                // unsigned int ipr1 = ipr_min + int(Rand::uniform()*(ipr_max - ipr_min));
-                                // unsigned int ipr2 = ipr_min + int(Rand::uniform()*(ipr_max - ipr_min));
-                                // while (ipr1 == ipr2)
-                                // {
-                                //     ipr2 = ipr_min + int(Rand::uniform()*(ipr_max - ipr_min));
-                                // }
-                                //
-                                // for (ipr = ipr_min; ipr < ipr_max ; ipr ++) {
-                                //     if (ipr == ipr1) {
-                                //         ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                                //         momentum_x[ip] = new_momentum_norm*(cos_omega*e1_x + sin_omega*e2_x);
-                                //         momentum_y[ip] = new_momentum_norm*(cos_omega*e1_y + sin_omega*e2_y);
-                                //         momentum_z[ip] = new_momentum_norm*(cos_omega*e1_z + sin_omega*e2_z);
-                                //         weight[ip] = 0.5*total_weight;
-                                //     } else if (ipr == ipr2) {
-                                //         ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                                //         momentum_x[ip] = new_momentum_norm*(cos_omega*e1_x - sin_omega*e2_x);
-                                //         momentum_y[ip] = new_momentum_norm*(cos_omega*e1_y - sin_omega*e2_y);
-                                //         momentum_z[ip] = new_momentum_norm*(cos_omega*e1_z - sin_omega*e2_z);
-                                //         weight[ip] = 0.5*total_weight;
-                                //     } else {
-                                //         ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                                //         mask[ip] = -1;
-                                //         count--;
-                                //     }
-                                // }
-
-                            // Special treatment for collinear photons
-                            // Collinear particles are merged
-                            } else {
-
-                                if (mass == 0) {
-                                    // Method 1: determinist - use the position of
-                                    // the first particles of the list
-
-                                    // Update momentum of the first photon
-                                    ip = sorted_particles[momentum_cell_particle_index[ic] + ipr_min];
-
-                                    momentum_x[ip] = new_momentum_norm*e1_x;
-                                    momentum_y[ip] = new_momentum_norm*e1_y;
-                                    momentum_z[ip] = new_momentum_norm*e1_z;
-                                    weight[ip] = total_weight;
-
-                                    // Other photons are tagged to be removed after
-                                    for (ipr = ipr_min + 1; ipr < ipr_max ; ipr ++) {
-                                        ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                                        mask[ip] = -1;
-                                        count--;
-                                    }
-
-                                    // Method 2: random - pick up randomly old particle positions
-
-                                    // unsigned int ipr1 = ipr_min + int(Rand::uniform()*(ipr_max - ipr_min));
-                                    // for (ipr = ipr_min; ipr < ipr_max ; ipr ++) {
-                                    //     if (ipr == ipr1) {
-                                    //         ip = sorted_particles[momentum_cell_particle_index[ic] + ipr1];
-                                    //         momentum_x[ip] = new_momentum_norm*e1_x;
-                                    //         momentum_y[ip] = new_momentum_norm*e1_y;
-                                    //         momentum_z[ip] = new_momentum_norm*e1_z;
-                                    //         weight[ip] = total_weight;
-                                    //     } else {
-                                    //         ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                                    //         mask[ip] = -1;
-                                    //         count--;
-                                    //     }
-                                    // }
-                                }
-
-                            }// end check collinear momenta
+                // _______________________________________________________________
+
+                // Compute total weight, total momentum and total energy
+
+                for (unsigned int ipr = ipr_min ; ipr < ipr_max ; ipr ++) {
+
+                    // Relative index and particle index in Particles
+                    const unsigned int ic_ipr = cell_particles[ipr];
+                    const unsigned int ip = particle_index[ic_ipr];
+
+                    // Total weight (wt)
+                    total_weight += weight[ip];
+
+                    // total momentum vector (pt)
+                    total_momentum_x += momentum_x[ip]*weight[ip];
+                    total_momentum_y += momentum_y[ip]*weight[ip];
+                    total_momentum_z += momentum_z[ip]*weight[ip];
+
+                    // total energy
+                    total_energy += weight[ip]*gamma[ic_ipr];
+
+                }
 
+                // \varepsilon_a in Vranic et al
+                const double new_energy = total_energy / total_weight;
+
+                // pa in Vranic et al.
+                double new_momentum_norm;
+                // For photons
+                if (mass == 0) {
+                    new_momentum_norm = new_energy;
+                // For mass particles
+                } else {
+                    new_momentum_norm = sqrt(new_energy*new_energy - 1.0);
+                }
+
+                // Total momentum norm
+                double total_momentum_norm = sqrt(total_momentum_x*total_momentum_x
+                                           +      total_momentum_y*total_momentum_y
+                                           +      total_momentum_z*total_momentum_z);
+
+                // Angle between pa and pt, pb and pt in Vranic et al.
+                const double cos_omega = std::min(total_momentum_norm / (total_weight*new_momentum_norm),1.0);
+                const double sin_omega = sqrt(1 - cos_omega*cos_omega);
+
+                // Now, represents the inverse to avoid useless division
+                total_momentum_norm = 1/total_momentum_norm;
+
+                // Computation of e1 unit vector
+                const double e1_x = total_momentum_x*total_momentum_norm;
+                const double e1_y = total_momentum_y*total_momentum_norm;
+                const double e1_z = total_momentum_z*total_momentum_norm;
+
+                // e3 = e1 x cell_vec
+                const double e3_x = e1_y*cell_vec_z - e1_z*cell_vec_y;
+                const double e3_y = e1_z*cell_vec_x - e1_x*cell_vec_z;
+                const double e3_z = e1_x*cell_vec_y - e1_y*cell_vec_x;
+
+                // All particle momenta are not collinear
+                if (fabs(e3_x*e3_x + e3_y*e3_y + e3_z*e3_z) > 0)
+                {
+
+                    // Computation of e2  = e1 x e3 unit vector
+                    double e2_x = e1_y*e3_z - e1_z*e3_y;
+                    double e2_y = e1_z*e3_x - e1_x*e3_z;
+                    double e2_z = e1_x*e3_y - e1_y*e3_x;
+
+                    const double e2_norm = 1./sqrt(e2_x*e2_x + e2_y*e2_y + e2_z*e2_z);
+
+                    // e2 is normalized to be a unit vector
+                    e2_x = e2_x * e2_norm;
+                    e2_y = e2_y * e2_norm;
+                    e2_z = e2_z * e2_norm;
+
+                    // Create the merged particles
+                    // --------------------------------------------
+
+                    // Method 1: determinist - use the position of
+                    // the first particles of the list
+
+                    // Update momentum of the first photon
+                    unsigned int ip = particle_index[cell_particles[ipr_min]];
+
+                    momentum_x[ip] = new_momentum_norm*(cos_omega*e1_x + sin_omega*e2_x);
+                    momentum_y[ip] = new_momentum_norm*(cos_omega*e1_y + sin_omega*e2_y);
+                    momentum_z[ip] = new_momentum_norm*(cos_omega*e1_z + sin_omega*e2_z);
+                    weight[ip] = 0.5*total_weight;
+
+                    // Update momentum of the second particle
+                    ip = particle_index[cell_particles[ipr_min + 1]];
+                    momentum_x[ip] = new_momentum_norm*(cos_omega*e1_x - sin_omega*e2_x);
+                    momentum_y[ip] = new_momentum_norm*(cos_omega*e1_y - sin_omega*e2_y);
+                    momentum_z[ip] = new_momentum_norm*(cos_omega*e1_z - sin_omega*e2_z);
+                    weight[ip] = 0.5*total_weight;
+
+                    // Other photons are tagged to be removed after
+                    for (unsigned int ipr = ipr_min + 2; ipr < ipr_max ; ipr ++) {
+                        mask[particle_index[cell_particles[ipr]]] = -1;
+                        removed++;
+                    }
+
+                // Special treatment for collinear photons
+                // Collinear particles are merged
+                } else {
+
+                    if (mass == 0) {
+                        // Method 1: determinist - use the position of
+                        // the first particles of the list
+
+                        // Update momentum of the first photon
+                        const unsigned int ip = particle_index[cell_particles[ipr_min]];
+
+                        momentum_x[ip] = new_momentum_norm*e1_x;
+                        momentum_y[ip] = new_momentum_norm*e1_y;
+                        momentum_z[ip] = new_momentum_norm*e1_z;
+                        weight[ip] = total_weight;
+
+                        // Other photons are tagged to be removed after
+                        for (unsigned int ipr = ipr_min + 1; ipr < ipr_max ; ipr ++) {
+                            mask[particle_index[cell_particles[ipr]]] = -1;
+                            removed++;
                         }
                     }
 
-                }
+                }// end check collinear momenta
+
             }
-        }
 
-        // Free aligned arrays
-        // free(gamma);
-        // free(momentum_cell_index);
-        // free(sorted_particles);
-        // free(particles_per_momentum_cells);
-        // free(momentum_cell_particle_index);
-        
-        // Free arrays
-        delete [] gamma;
-        delete [] momentum_cell_index;
-        delete [] sorted_particles;
-        delete [] particles_per_momentum_cells;
-        delete [] momentum_cell_particle_index;
+            return removed;
+        };
+
+        // Loop over the the momentum cells that have enough particles
+        mergeMomentumCells( number_of_particles, momentum_cells, count, mergeMomentumCell );
     }
 
 }
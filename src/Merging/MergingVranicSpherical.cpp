@@ -53,26 +53,24 @@ MergingVranicSpherical::~MergingVranicSpherical()
 
 
 // ---------------------------------------------------------------------
-//! Overloading of () operator: perform the Vranic particle merging
+//! Perform the Vranic particle merging in a cell
 //! \param particles   particle object containing the particle
 //!                    properties
-//! \param istart      Index of the first particle
-//! \param iend        Index of the last particle
+//! \param particle_index indexes of the particles of the cell
+//! \param number_of_particles number of particles of the cell
 //! \param count       Final number of particles
 // ---------------------------------------------------------------------
-void MergingVranicSpherical::operator() (
+void MergingVranicSpherical::merge(
         double mass,
         Particles &particles,
         std::vector <int> &mask,
-        int istart,
-        int iend,
+        const unsigned int * particle_index,
+        unsigned int number_of_particles,
         int & count)
         //unsigned int &remaining_particles,
         //unsigned int &merged_particles)
 {
 
-    unsigned int number_of_particles = (unsigned int)(iend - istart);
-
     // First of all, we check that there is enought particles per cell
     // to process the merging.
     if (number_of_particles > min_particles_per_cell_) {
@@ -83,42 +81,36 @@ void MergingVranicSpherical::operator() (
         //     dim[i] = dimensions_[i];
         // }
 
+        // Scratch arrays of this thread
+        MergingBuffers & buffers = threadBuffers();
+
         unsigned int mr_dim = dimensions_[0];
         unsigned int theta_dim_ref = dimensions_[1];
         unsigned int theta_dim_min = 1;
         unsigned int phi_dim = dimensions_[2];
-//        std::vector <unsigned int> theta_dim(phi_dim,0);
-        // unsigned int  * theta_dim = (unsigned int*) aligned_alloc(64, phi_dim*sizeof(unsigned int));
-        unsigned int  * theta_dim = new unsigned int [phi_dim];
+        unsigned int  * theta_dim = MergingBuffers::reserve( buffers.theta_dim, phi_dim );
 
         // Minima
         double mr_min;
         double theta_min_ref;
-//        std::vector <double> theta_min(phi_dim,0);
-        // double  * theta_min = (double*) aligned_alloc(64, phi_dim*sizeof(double));
-        double  * theta_min = new double [phi_dim];
+        double  * theta_min = MergingBuffers::reserve( buffers.theta_min, phi_dim );
         double phi_min;
 
         // Maxima
         double mr_max;
         double theta_max_ref;
-//        std::vector <double> theta_max(phi_dim,0);
-        // double  * theta_max = (double*) aligned_alloc(64, phi_dim*sizeof(double));
-        double  * theta_max = new double[phi_dim];
+        double  * theta_max = MergingBuffers::reserve( buffers.theta_max, phi_dim );
         double phi_max;
 
         // Delta
         double mr_delta;
         double theta_delta_ref;
-//        std::vector <double> theta_delta(phi_dim,0);
-        double  * theta_delta = new double[phi_dim];
+        double  * theta_delta = MergingBuffers::reserve( buffers.theta_delta, phi_dim );
         double phi_delta;
 
         // Inverse Delta
         double inv_mr_delta;
-//        std::vector <double> inv_theta_delta(phi_dim,0);
-        //double  * inv_theta_delta = (double*) aligned_alloc(64, phi_dim*sizeof(double));
-        double  * inv_theta_delta = new double [phi_dim];
+        double  * inv_theta_delta = MergingBuffers::reserve( buffers.inv_theta_delta, phi_dim );
         double inv_phi_delta;
 
         // Interval
@@ -129,9 +121,6 @@ void MergingVranicSpherical::operator() (
         // Angles
         double phi;
         double theta;
-        // double omega;
-        double cos_omega;
-        double sin_omega;
 
         // Index in each direction
         unsigned int mr_i;
@@ -140,27 +129,9 @@ void MergingVranicSpherical::operator() (
 
         // Local particle index
         unsigned int ic, icc;
-        unsigned int ipack;
-        unsigned int npack;
-        unsigned int ipr, ipr_min, ipr_max;
+        unsigned int ipr;
         unsigned int ip;
 
-        // Total weight for merging process
-        double total_weight;
-        // double total_momentum_x;
-        // double total_momentum_y;
-        // double total_momentum_z;
-        // double total_momentum_norm;
-        double total_energy;
-
-        // New particle properties
-        double new_energy;
-        double new_momentum_norm;
-        double e1_x,e1_y,e1_z;
-        double e2_x,e2_y,e2_z;
-        double e3_x,e3_y,e3_z;
-        double e2_norm;
-
         // Momentum shortcut
         double * __restrict__ momentum_x = particles.getPtrMomentum(0);
         double * __restrict__ momentum_y = particles.getPtrMomentum(1);
@@ -173,35 +144,24 @@ void MergingVranicSpherical::operator() (
         // int *cell_keys = &( particles.cell_keys[0] );
 
         // Norm of the momentum
-//        std::vector <double> momentum_norm(number_of_particles,0);
-        // double  * momentum_norm = (double*) aligned_alloc(64, number_of_particles*sizeof(double));
-        double  * momentum_norm = new double [number_of_particles];
+        double  * momentum_norm = MergingBuffers::reserve( buffers.gamma, number_of_particles );
 
         // Local vector to store the momentum index in the momentum discretization
-//        std::vector <unsigned int> momentum_cell_index(number_of_particles,0);
-        // unsigned int  * momentum_cell_index = (unsigned int*) aligned_alloc(64, number_of_particles*sizeof(unsigned int));
-        unsigned int  * momentum_cell_index = new unsigned int [number_of_particles];
+        unsigned int  * momentum_cell_index = MergingBuffers::reserve( buffers.momentum_cell_index, number_of_particles );
 
-        // Sorted array of particle index
-//        std::vector <unsigned int> sorted_particles(number_of_particles,0);
-        // unsigned int  * sorted_particles = (unsigned int*) aligned_alloc(64, number_of_particles*sizeof(unsigned int));
-        unsigned int  * sorted_particles = new unsigned int [number_of_particles];
+        // Sorted array of (relative) particle index
+        unsigned int  * sorted_particles = MergingBuffers::reserve( buffers.sorted_particles, number_of_particles );
 
         // Local vector to store the momentum angles in the spherical base
-//        std::vector <double> particles_phi(number_of_particles,0);
-//        std::vector <double> particles_theta(number_of_particles,0);
-        // double  * particles_phi = (double*) aligned_alloc(64, number_of_particles*sizeof(double));
-        double  * particles_phi = new double [number_of_particles];
-        // double  * particles_theta = (double*) aligned_alloc(64, number_of_particles*sizeof(double));
-        double  * particles_theta = new double [number_of_particles];
+        double  * particles_phi = MergingBuffers::reserve( buffers.particles_phi, number_of_particles );
+        double  * particles_theta = MergingBuffers::reserve( buffers.particles_theta, number_of_particles );
 
         // Computation of the particle momentum properties
-        #pragma omp simd private(ipr)
-//         aligned(momentum_norm, particles_theta, particles_phi: 64)
-        for (ip=(unsigned int)(istart) ; ip<(unsigned int) (iend); ip++ ) {
+        #pragma omp simd private(ip)
+        for (ipr=0 ; ipr<number_of_particles; ipr++ ) {
 
-            // Local array index
-            ipr = ip - istart;
+            // Particle array index
+            ip = particle_index[ipr];
 
             momentum_norm[ipr] = sqrt(momentum_x[ip]*momentum_x[ip]
                           + momentum_y[ip]*momentum_y[ip]
@@ -439,17 +399,13 @@ void MergingVranicSpherical::operator() (
         }
 
         // Array containing the number of particles per momentum cells
-//        std::vector <unsigned int> particles_per_momentum_cells(momentum_cells,0);
-        //unsigned int  * particles_per_momentum_cells = (unsigned int*) aligned_alloc(64, momentum_cells*sizeof(unsigned int));
-        unsigned int  * particles_per_momentum_cells = new unsigned int [momentum_cells];
+        unsigned int  * particles_per_momentum_cells = MergingBuffers::reserve( buffers.particles_per_momentum_cells, momentum_cells );
 
         // Array containing the first particle index of each momentum cell
         // in the sorted particle array
-//        std::vector <unsigned int> momentum_cell_particle_index(momentum_cells,0);
-        //unsigned int  * momentum_cell_particle_index = (unsigned int*) aligned_alloc(64, momentum_cells*sizeof(unsigned int));
-        unsigned int  * momentum_cell_particle_index = new unsigned int [momentum_cells];
-//
-//         // Initialization when using aligned_alloc
+        unsigned int  * momentum_cell_particle_index = MergingBuffers::reserve( buffers.momentum_cell_particle_index, momentum_cells );
+
+        // Initialization of the reused arrays
         #pragma omp simd
         for (ic = 0 ; ic < momentum_cells ; ic++) {
             momentum_cell_particle_index[ic] = 0;
@@ -458,9 +414,7 @@ void MergingVranicSpherical::operator() (
 
         // First Cell index in theta for each phi coordinates
         // (necessary since the theta_dim depends on phi)
-//        std::vector <unsigned int>  theta_start_index (phi_dim);
-        // unsigned int *  theta_start_index = (unsigned int *) aligned_alloc(64, phi_dim*sizeof(unsigned int));
-        unsigned int *  theta_start_index = new unsigned int [phi_dim];
+        unsigned int *  theta_start_index = MergingBuffers::reserve( buffers.theta_start_index, phi_dim );
 
         // Computation of the first cell index for each phi
         theta_start_index[0] = 0;
@@ -472,16 +426,10 @@ void MergingVranicSpherical::operator() (
         // Only necessary for mass particles
 
         // Cell direction unit vector in the spherical base
-        //std::vector <double> cell_vec_x(momentum_angular_cells,0);
-        //std::vector <double> cell_vec_y(momentum_angular_cells,0);
-        //std::vector <double> cell_vec_z(momentum_angular_cells,0);
-        // double  * cell_vec_x = (double*) aligned_alloc(64, momentum_angular_cells*sizeof(double));
-        // double  * cell_vec_y = (double*) aligned_alloc(64, momentum_angular_cells*sizeof(double));
-        // double  * cell_vec_z = (double*) aligned_alloc(64, momentum_angular_cells*sizeof(double));
-        double  * cell_vec_x = new double [momentum_angular_cells];
-        double  * cell_vec_y = new double [momentum_angular_cells];
-        double  * cell_vec_z = new double [momentum_angular_cells];
-        
+        double  * cell_vec_x = MergingBuffers::reserve( buffers.cell_vec_x, momentum_angular_cells );
+        double  * cell_vec_y = MergingBuffers::reserve( buffers.cell_vec_y, momentum_angular_cells );
+        double  * cell_vec_z = MergingBuffers::reserve( buffers.cell_vec_z, momentum_angular_cells );
+
         for (phi_i = 0 ; phi_i < phi_dim ; phi_i ++) {
 
             #pragma omp simd private(theta, phi, icc)
@@ -610,7 +558,7 @@ void MergingVranicSpherical::operator() (
             ic = momentum_cell_index[ipr];
 
             sorted_particles[momentum_cell_particle_index[ic]
-            + particles_per_momentum_cells[ic]] = istart + ipr;
+            + particles_per_momentum_cells[ic]] = ipr;
 
             particles_per_momentum_cells[ic] += 1;
         }
@@ -645,399 +593,198 @@ void MergingVranicSpherical::operator() (
 
 
         // For each momentum bin, merge packet of particles composed of
-        // at least `min_packet_size_` and `max_packet_size_`
+        // at least `min_packet_size_` and `max_packet_size_`.
+        // Momentum cells are independent from each other so that they
+        // can be processed in any order or in parallel.
+        // Returns the number of removed particles.
+        auto mergeMomentumCell = [&]( unsigned int ic ) -> int {
+
+            // Check if there is enought particles in the momentum
+            // cell to trigger the merging procecc
+            if (particles_per_momentum_cells[ic] < min_packet_size_ ) {
+                return 0;
+            }
 
-        // Loop over the the momentum cells that have enough particles
-        for (phi_i=0 ; phi_i< phi_dim; phi_i++ ) {
-            for (theta_i=0 ; theta_i< theta_dim[phi_i]; theta_i++ ) {
+            int removed = 0;
 
-                // 1D cell direction index
-                icc = theta_i + theta_start_index[phi_i] ;
+            // 1D cell direction index
+            const unsigned int icc = ic / mr_dim;
 
-                for (mr_i=0 ; mr_i< mr_dim; mr_i++ ) {
+            // Sorted (relative) particle indexes of this momentum cell
+            const unsigned int * cell_particles = &sorted_particles[momentum_cell_particle_index[ic]];
 
-                    // 1D cell index
-                    ic = mr_i + icc*mr_dim;
+            // Computation of the number of particle packets to merge
+            unsigned int npack = particles_per_momentum_cells[ic]/max_packet_size_;
 
-                    // Check if there is enought particles in the momentum
-                    // cell to trigger the merging procecc
-                    if (particles_per_momentum_cells[ic] >= min_packet_size_ ) {
+            // Check if the rest is sufficient to add an additional smaller packet
+            if (particles_per_momentum_cells[ic]%max_packet_size_ >= min_packet_size_) {
+                npack += 1;
+            }
 
-                        // Computation of the number of particle packets to merge
-                        npack = particles_per_momentum_cells[ic]/max_packet_size_;
+            // Loop over the packets of particles that can be merged
+            for (unsigned int ipack = 0 ; ipack < npack ; ipack += 1) {
 
-                        // Check if the rest is sufficient to add an additional smaller packet
-                        if (particles_per_momentum_cells[ic]%max_packet_size_ >= min_packet_size_) {
-                            npack += 1;
-                        }
+                // _______________________________________________________________
+                // Average on mx, my mz like the Cartesian scale
+
+                double total_weight = 0;
+                double total_energy = 0;
+                double total_momentum_x = 0;
+                double total_momentum_y = 0;
+                double total_momentum_z = 0;
+                double total_momentum_norm = 0;
+
+                // First index of the packet
+                const unsigned int ipr_min = ipack*max_packet_size_;
+                // last index of the packet
+                const unsigned int ipr_max = std::min((ipack+1)*max_packet_size_,particles_per_momentum_cells[ic]);
+
+                // Compute total weight, total momentum and total energy
+                // for photons
+                if (mass == 0) {
+
+                    for (unsigned int ipr = ipr_min ; ipr < ipr_max ; ipr ++) {
+
+                        // Relative index and particle index in Particles
+                        const unsigned int ic_ipr = cell_particles[ipr];
+                        const unsigned int ip = particle_index[ic_ipr];
+
+                        // Total weight (wt)
+                        total_weight += weight[ip];
+
+                        // total momentum vector (pt)
+                        total_momentum_x += momentum_x[ip]*weight[ip];
+                        total_momentum_y += momentum_y[ip]*weight[ip];
+                        total_momentum_z += momentum_z[ip]*weight[ip];
+
+                        total_energy += weight[ip]*momentum_norm[ic_ipr];
+
+                    }
+
+                // Compute total weight, total momentum and total energy
+                // for particles
+                } else {
+
+                    for (unsigned int ipr = ipr_min ; ipr < ipr_max ; ipr ++) {
+
+                        // Relative index and particle index in Particles
+                        const unsigned int ic_ipr = cell_particles[ipr];
+                        const unsigned int ip = particle_index[ic_ipr];
+
+                        // Total weight (wt)
+                        total_weight += weight[ip];
+
+                        // total momentum vector (pt)
+                        total_momentum_x += momentum_x[ip]*weight[ip];
+                        total_momentum_y += momentum_y[ip]*weight[ip];
+                        total_momentum_z += momentum_z[ip]*weight[ip];
 
-                        // Loop over the packets of particles that can be merged
-                        for (ipack = 0 ; ipack < npack ; ipack += 1) {
-
-                            // if (min_momentum_log_scale_) {
-                            //
-                            //     // _______________________________________________________________
-                            //     // First Method: Average on mr, theta and phi
-                            //     // Compute total weight, total momentum and total energy
-                            //     // Photons
-                            //
-                            //     total_weight = 0;
-                            //     total_energy = 0;
-                            //     double mr = 0;
-                            //     theta=0;
-                            //     phi = 0;
-                            //
-                            //     // First index of the packet
-                            //     ipr_min = ipack*max_packet_size_;
-                            //     // last index of the packet
-                            //     ipr_max = std::min((ipack+1)*max_packet_size_,particles_per_momentum_cells[ic]);
-                            //
-                            //     // Compute total weight, total momentum and total energy
-                            //     // for photons
-                            //     if (mass == 0) {
-                            //
-                            //         for (ipr = ipr_min ; ipr < ipr_max ; ipr ++) {
-                            //
-                            //             // Particle index in Particles
-                            //             ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                            //
-                            //             // Total weight (wt)
-                            //             total_weight += weight[ip];
-                            //
-                            //             mr += weight[ip]*momentum_norm[ip - istart];
-                            //             theta += weight[ip]*particles_theta[ip - istart];
-                            //             phi += weight[ip]*particles_phi[ip - istart];
-                            //
-                            //         }
-                            //
-                            //         total_energy = mr;
-                            //     // Compute total weight, total momentum and total energy
-                            //     // for particles
-                            //     } else {
-                            //
-                            //         for (ipr = ipr_min ; ipr < ipr_max ; ipr ++) {
-                            //
-                            //             // Particle index in Particles
-                            //             ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                            //
-                            //             // Total weight (wt)
-                            //             total_weight += weight[ip];
-                            //
-                            //             mr += weight[ip]*momentum_norm[ip - istart];
-                            //             theta += weight[ip]*particles_theta[ip - istart];
-                            //             phi += weight[ip]*particles_phi[ip - istart];
-                            //
-                            //             // total energy (\varespilon_t)
-                            //             total_energy += weight[ip]
-                            //                                      * sqrt(1.0 + momentum_x[ip]*momentum_x[ip]
-                            //                                      + momentum_y[ip]*momentum_y[ip]
-                            //                                      + momentum_z[ip]*momentum_z[ip]);
-                            //
-                            //         }
-                            //     }
-                            //
-                            //     // here for photon, this parameter is the inverse of total_weight
-                            //     new_momentum_norm = 1 / total_weight;
-                            //
-                            //     theta = theta * new_momentum_norm;
-                            //     phi = phi * new_momentum_norm;
-                            //
-                            //     // \varepsilon_a in Vranic et al
-                            //     new_energy = total_energy * new_momentum_norm;
-                            //
-                            //     // pa in Vranic et al.
-                            //     // For photons
-                            //     if (mass == 0) {
-                            //         new_momentum_norm = new_energy;
-                            //     // For mass particles
-                            //     } else {
-                            //         new_momentum_norm = sqrt(new_energy*new_energy - 1.0);
-                            //     }
-                            //
-                            //     // Angle between pa and pt, pb and pt in Vranic et al.
-                            //     // omega = std::acos(std::min(mr / (total_weight*new_momentum_norm),1.0));
-                            //     cos_omega = std::min(mr / (total_weight*new_momentum_norm),1.0);
-                            //     sin_omega = sqrt(1 - cos_omega*cos_omega);
-                            //
-                            //     // Computation of e1 unit vector
-                            //     e1_x = cos(theta)*cos(phi);
-                            //     e1_y = sin(theta)*cos(phi);
-                            //     e1_z = sin(phi);
-                            //
-                            // // Linear scale
-                            // } else {
-
-                            // _______________________________________________________________
-                            // Second method: Average on mx, my mz like the Cartesian scale
-
-                            total_weight = 0;
-                            total_energy = 0;
-                            double total_momentum_x = 0;
-                            double total_momentum_y = 0;
-                            double total_momentum_z = 0;
-                            double total_momentum_norm = 0;
-
-                            // // First index of the packet
-                            ipr_min = ipack*max_packet_size_;
-                            // // last index of the packet
-
-                            ipr_max = std::min((ipack+1)*max_packet_size_,particles_per_momentum_cells[ic]);
-
-                            // Compute total weight, total momentum and total energy
-                            // for photons
-                            if (mass == 0) {
-
-                                for (ipr = ipr_min ; ipr < ipr_max ; ipr ++) {
-
-                                    // Particle index in Particles
-                                    ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-
-                                    // Total weight (wt)
-                                    total_weight += weight[ip];
-
-                                    // total momentum vector (pt)
-                                    total_momentum_x += momentum_x[ip]*weight[ip];
-                                    total_momentum_y += momentum_y[ip]*weight[ip];
-                                    total_momentum_z += momentum_z[ip]*weight[ip];
-
-                                    total_energy += weight[ip]*momentum_norm[ip - istart];
-
-                                }
-
-                            // Compute total weight, total momentum and total energy
-                            // for particles
-                            } else {
-
-                                for (ipr = ipr_min ; ipr < ipr_max ; ipr ++) {
-
-                                    // Particle index in Particles
-                                    ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-
-                                    // Total weight (wt)
-                                    total_weight += weight[ip];
-
-                                    // total momentum vector (pt)
-                                    total_momentum_x += momentum_x[ip]*weight[ip];
-                                    total_momentum_y += momentum_y[ip]*weight[ip];
-                                    total_momentum_z += momentum_z[ip]*weight[ip];
-
-                                    // total energy (\varespilon_t)
-                                    total_energy += weight[ip]
-                                            * sqrt(1.0 + momentum_norm[ip - istart]*momentum_norm[ip - istart]);
-
-                                }
-                            }
-
-                            // \varepsilon_a in Vranic et al
-                            new_energy = total_energy / total_weight;
-
-                            // pa in Vranic et al.
-                            // For photons
-                            if (mass == 0) {
-                                new_momentum_norm = new_energy;
-                            // For mass particles
-                            } else {
-                                new_momentum_norm = sqrt(new_energy*new_energy - 1.0);
-                            }
-
-                            // Total momentum norm
-                            total_momentum_norm = sqrt(total_momentum_x*total_momentum_x
-                                                +      total_momentum_y*total_momentum_y
-                                                +      total_momentum_z*total_momentum_z);
-
-                            // Angle between pa and pt, pb and pt in Vranic et al.
-                            // omega = std::acos(std::min(mr / (total_weight*new_momentum_norm),1.0));
-                            cos_omega = std::min(total_momentum_norm / (total_weight*new_momentum_norm),1.0);
-                            sin_omega = sqrt(1 - cos_omega*cos_omega);
-
-                            // Now, represents the inverse to avoid useless division
-                            total_momentum_norm = 1/total_momentum_norm;
-
-                            // Computation of e1 unit vector
-                            e1_x = total_momentum_x*total_momentum_norm;
-                            e1_y = total_momentum_y*total_momentum_norm;
-                            e1_z = total_momentum_z*total_momentum_norm;
-
-                            // } // End check logarithmic scale
-
-                            // e3 = e1 x cell_vec
-                            e3_x = e1_y*cell_vec_z[icc] - e1_z*cell_vec_y[icc];
-                            e3_y = e1_z*cell_vec_x[icc] - e1_x*cell_vec_z[icc];
-                            e3_z = e1_x*cell_vec_y[icc] - e1_y*cell_vec_x[icc];
-
-                            // All particle momenta are not collinear
-                            if (std::abs(e3_x*e3_x + e3_y*e3_y + e3_z*e3_z) > 0)
-                            {
-
-                                // Computation of e2  = e1 x e3 unit vector
-                                // e2_x = e1_y*e1_y*cell_vec_x[icc]
-                                //      - e1_x * (e1_y*cell_vec_y[icc] + e1_z*cell_vec_z[icc])
-                                //      + e1_z*e1_z*cell_vec_x[icc];
-                                // e2_y = e1_z*e1_z*cell_vec_y[icc]
-                                //      - e1_y * (e1_z*cell_vec_z[icc] + e1_x*cell_vec_x[icc])
-                                //      + e1_x*e1_x*cell_vec_y[icc];
-                                // e2_z = e1_x*e1_x*cell_vec_z[icc]
-                                //      - e1_z * (e1_x*cell_vec_x[icc] + e1_y*cell_vec_y[icc])
-                                //      + e1_y*e1_y*cell_vec_z[icc];
-
-                                e2_x = e1_y*e3_z - e1_z*e3_y;
-                                e2_y = e1_z*e3_x - e1_x*e3_z;
-                                e2_z = e1_x*e3_y - e1_y*e3_x;
-
-                                e2_norm = sqrt(e2_x*e2_x + e2_y*e2_y + e2_z*e2_z);
-
-                                // e2 is normalized to be a unit vector
-                                e2_x = e2_x / e2_norm;
-                                e2_y = e2_y / e2_norm;
-                                e2_z = e2_z / e2_norm;
-
-                                // Update momentum of the first particle
-                                ip = sorted_particles[momentum_cell_particle_index[ic] + ipr_min];
-                                momentum_x[ip] = new_momentum_norm*(cos_omega*e1_x + sin_omega*e2_x);
-                                momentum_y[ip] = new_momentum_norm*(cos_omega*e1_y + sin_omega*e2_y);
-                                momentum_z[ip] = new_momentum_norm*(cos_omega*e1_z + sin_omega*e2_z);
-                                weight[ip] = 0.5 * total_weight;
-
-                                // Update momentum of the second particle
-                                ip = sorted_particles[momentum_cell_particle_index[ic] + ipr_min + 1];
-                                momentum_x[ip] = new_momentum_norm*(cos_omega*e1_x - sin_omega*e2_x);
-                                momentum_y[ip] = new_momentum_norm*(cos_omega*e1_y - sin_omega*e2_y);
-                                momentum_z[ip] = new_momentum_norm*(cos_omega*e1_z - sin_omega*e2_z);
-                                weight[ip] = 0.5*total_weight;
-
-                                // Other photons are tagged to be removed after
-                                for (ipr = ipr_min + 2; ipr < ipr_max ; ipr ++) {
-                                    ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                                    mask[ip] = -1;
-                                    count--;
-                                }
-
-                                // -------------------------------------------------------------------------------------
-                                // Checkpoint for debugging
-
-                                // double mr = sqrt(momentum_x[ip]*momentum_x[ip] +
-                                //           momentum_y[ip]*momentum_y[ip] +
-                                //           momentum_z[ip]*momentum_z[ip]);
-                                // double mr_b, mr_a;
-                                // if (log_scale_) {
-                                //     mr_b = pow(10.,(mr_i) * mr_delta + mr_min);
-                                //     mr_a = pow(10.,(mr_i+1) * mr_delta + mr_min);
-                                // } else {
-                                //     mr_b = (mr_i) * mr_delta + mr_min;
-                                //     mr_a = (mr_i+1) * mr_delta + mr_min;
-                                // }
-                                // double phi2 = asin(momentum_z[ip] / mr);
-                                // double theta2 = atan2(momentum_y[ip] , momentum_x[ip]);
-                                // if (std::isnan(momentum_x[ip])
-                                //      || (std::isnan(momentum_y[ip]))
-                                //      || (std::isnan(momentum_z[ip]))
-                                //     || (std::isnan(momentum_x[ip]))
-                                //     || (std::isnan(weight[ip]))
-                                //     || (phi2 < phi_i * phi_delta + phi_min)
-                                //     || (phi2 > (phi_i+1) * phi_delta + phi_min)
-                                //     // (theta < theta_i * theta_delta[phi_i] + theta_min) ||
-                                //     // (theta > (theta_i+1) * theta_delta[phi_i] + theta_min) ||
-                                //     || (theta2 < theta_i * theta_delta[phi_i] + theta_min[phi_i])
-                                //     || (theta2 > (theta_i+1) * theta_delta[phi_i] + theta_min[phi_i])
-                                //     || (mr < mr_b)
-                                //     || (mr > mr_a)
-                                //     ) {
-                                //     //std::cerr <<
-                                //     ERROR( std::scientific
-                                //               << std::setprecision(15)
-                                //               << " theta: " << theta
-                                //               << " theta2: " << theta2
-                                //               << " Pi/2: " << M_PI*0.5
-                                //               << " theta[i]: " << theta_i * theta_delta[phi_i] + theta_min[phi_i]
-                                //               << " theta[i+1]: " << (theta_i+1) * theta_delta[phi_i] + theta_min[phi_i]
-                                //               << " theta_min: " << theta_min[phi_i]
-                                //               << " theta_max: " << theta_max[phi_i]
-                                //               << " cos(theta): " << cos(theta)
-                                //               << " phi: " << phi
-                                //               << " phi2: " << phi2
-                                //               << " phi[i]: " << phi_i * phi_delta + phi_min
-                                //               << " phi[i+1]: " << (phi_i+1) * phi_delta + phi_min
-                                //               << " cos(phi): " << cos(phi)
-                                //               << " mr: " << mr
-                                //               << " mr[i]: " << mr_b
-                                //               << " mr[i+1]: " << mr_a
-                                //               << " dim: " << mr_dim << " " << theta_dim[phi_i] << " " << phi_dim
-                                //               << " mx: " << momentum_x[ip]
-                                //               << " my: " << momentum_y[ip]
-                                //               << " mz: " << momentum_z[ip]
-                                //               << " new_momentum_norm: " << new_momentum_norm
-                                //               << " total_weight: " << total_weight
-                                //               << " weight[ip]: " << weight[ip]
-                                //           )
-                                //     //<< std::endl;
-                                // }
-                                // -------------------------------------------------------------------------------------
-
-                            // Special treatment for collinear photons
-                            // Collinear particles are merged
-                            } else {
-
-                                if (mass == 0)
-                                {
-                                    // Method 1: determinist - use the position of
-                                    // the first particles of the list
-
-                                    // Update momentum of the first particle/photon
-                                    ip = sorted_particles[momentum_cell_particle_index[ic] + ipr_min];
-                                    momentum_x[ip] = new_momentum_norm*e1_x;
-                                    momentum_y[ip] = new_momentum_norm*e1_y;
-                                    momentum_z[ip] = new_momentum_norm*e1_z;
-                                    weight[ip] = total_weight;
-
-                                    // Other photons are tagged to be removed after
-                                    for (ipr = ipr_min + 1; ipr < ipr_max ; ipr ++) {
-                                        ip = sorted_particles[momentum_cell_particle_index[ic] + ipr];
-                                        mask[ip] = -1;
-                                        count--;
-                                    }
-                                }
-                            } // End check collinear
-                        } // end loop pack
-                    } // End if enought particles in the momentum cell
+                        // total energy (\varespilon_t)
+                        total_energy += weight[ip]
+                                * sqrt(1.0 + momentum_norm[ic_ipr]*momentum_norm[ic_ipr]);
+
+                    }
                 }
-            }
-        }
 
-        // Free aligned arrays
-        //free(momentum_norm);
-        //free(momentum_cell_index);
-        //free(cell_vec_x);
-        //free(cell_vec_y);
-        //free(cell_vec_z);
-        //free(particles_phi);
-        //free(particles_theta);
-        //free(sorted_particles);
-        //free(particles_per_momentum_cells);
-        //free(momentum_cell_particle_index);
-        //free(theta_start_index);
-        //free(theta_dim);
-        //free(theta_min);
-        //free(theta_max);
-        //free(theta_delta);
-        //free(inv_theta_delta);
-        
-        delete [] momentum_norm;
-        delete [] momentum_cell_index;
-        delete [] cell_vec_x;
-        delete [] cell_vec_y;
-        delete [] cell_vec_z;
-        delete [] particles_phi;
-        delete [] particles_theta;
-        delete [] sorted_particles;
-        delete [] particles_per_momentum_cells;
-        delete [] momentum_cell_particle_index;
-        delete [] theta_start_index;
-        delete [] theta_dim;
-        delete [] theta_min;
-        delete [] theta_max;
-        delete [] theta_delta;
-        delete [] inv_theta_delta;
-        
-    }
+                // \varepsilon_a in Vranic et al
+                const double new_energy = total_energy / total_weight;
+
+                // pa in Vranic et al.
+                double new_momentum_norm;
+                // For photons
+                if (mass == 0) {
+                    new_momentum_norm = new_energy;
+                // For mass particles
+                } else {
+                    new_momentum_norm = sqrt(new_energy*new_energy - 1.0);
+                }
+
+                // Total momentum norm
+                total_momentum_norm = sqrt(total_momentum_x*total_momentum_x
+                                    +      total_momentum_y*total_momentum_y
+                                    +      total_momentum_z*total_momentum_z);
+
+                // Angle between pa and pt, pb and pt in Vranic et al.
+                const double cos_omega = std::min(total_momentum_norm / (total_weight*new_momentum_norm),1.0);
+                const double sin_omega = sqrt(1 - cos_omega*cos_omega);
+
+                // Now, represents the inverse to avoid useless division
+                total_momentum_norm = 1/total_momentum_norm;
+
+                // Computation of e1 unit vector
+                const double e1_x = total_momentum_x*total_momentum_norm;
+                const double e1_y = total_momentum_y*total_momentum_norm;
+                const double e1_z = total_momentum_z*total_momentum_norm;
+
+                // Computation of e3  = e1 x cell_vec
+                const double e3_x = e1_y*cell_vec_z[icc] - e1_z*cell_vec_y[icc];
+                const double e3_y = e1_z*cell_vec_x[icc] - e1_x*cell_vec_z[icc];
+                const double e3_z = e1_x*cell_vec_y[icc] - e1_y*cell_vec_x[icc];
+
+                // All particle momenta are not collinear
+                if (std::abs(e3_x*e3_x + e3_y*e3_y + e3_z*e3_z) > 0)
+                {
+
+                    // Computation of e2  = e1 x e3 unit vector
+                    double e2_x = e1_y*e3_z - e1_z*e3_y;
+                    double e2_y = e1_z*e3_x - e1_x*e3_z;
+                    double e2_z = e1_x*e3_y - e1_y*e3_x;
+
+                    const double e2_norm = sqrt(e2_x*e2_x + e2_y*e2_y + e2_z*e2_z);
+
+                    // e2 is normalized to be a unit vector
+                    e2_x = e2_x / e2_norm;
+                    e2_y = e2_y / e2_norm;
+                    e2_z = e2_z / e2_norm;
+
+                    // Update momentum of the first particle
+                    unsigned int ip = particle_index[cell_particles[ipr_min]];
+                    momentum_x[ip] = new_momentum_norm*(cos_omega*e1_x + sin_omega*e2_x);
+                    momentum_y[ip] = new_momentum_norm*(cos_omega*e1_y + sin_omega*e2_y);
+                    momentum_z[ip] = new_momentum_norm*(cos_omega*e1_z + sin_omega*e2_z);
+                    weight[ip] = 0.5 * total_weight;
+
+                    // Update momentum of the second particle
+                    ip = particle_index[cell_particles[ipr_min + 1]];
+                    momentum_x[ip] = new_momentum_norm*(cos_omega*e1_x - sin_omega*e2_x);
+                    momentum_y[ip] = new_momentum_norm*(cos_omega*e1_y - sin_omega*e2_y);
+                    momentum_z[ip] = new_momentum_norm*(cos_omega*e1_z - sin_omega*e2_z);
+                    weight[ip] = 0.5*total_weight;
+
+                    // Other particles are tagged to be removed after
+                    for (unsigned int ipr = ipr_min + 2; ipr < ipr_max ; ipr ++) {
+                        mask[particle_index[cell_particles[ipr]]] = -1;
+                        removed++;
+                    }
+
+                // Special treatment for collinear photons
+                // Collinear particles are merged
+                } else {
+
+                    if (mass == 0)
+                    {
+
+                        // Update momentum of the first photon
+                        const unsigned int ip = particle_index[cell_particles[ipr_min]];
+                        momentum_x[ip] = new_momentum_norm*e1_x;
+                        momentum_y[ip] = new_momentum_norm*e1_y;
+                        momentum_z[ip] = new_momentum_norm*e1_z;
+                        weight[ip] = total_weight;
 
+                        // Other photons are tagged to be removed after
+                        for (unsigned int ipr = ipr_min + 1; ipr < ipr_max ; ipr ++) {
+                            mask[particle_index[cell_particles[ipr]]] = -1;
+                            removed++;
+                        }
+                    }
+                } // End check collinear
+            } // end loop pack
+
+            return removed;
+        };
+
+        // Loop over the the momentum cells that have enough particles
+        mergeMomentumCells( number_of_particles, momentum_cells, count, mergeMomentumCell );
+
+    }
 }
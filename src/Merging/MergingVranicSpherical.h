@@ -36,19 +36,19 @@ public:
     ~MergingVranicSpherical();
 
     // ---------------------------------------------------------------------
-    //! Overloading of () operator: perform the Vranic particle merging
+    //! Perform the Vranic particle merging in a cell
     //! \param particles   particle object containing the particle
     //!                    properties
-    //! \param istart      Index of the first particle
-    //! \param iend        Index of the last particle
+    //! \param particle_index indexes of the particles of the cell
+    //! \param number_of_particles number of particles of the cell
     //! \param count       Final number of particles
     // ---------------------------------------------------------------------
-    void operator()(
+    void merge(
         double mass,
         Particles &particles,
         std::vector <int> &mask,
-        int istart,
-        int iend,
+        const unsigned int * particle_index,
+        unsigned int number_of_particles,
         int & count) override;
         //unsigned int &remaining_particles,
         //unsigned int &merged_particles);
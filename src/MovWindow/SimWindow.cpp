@@ -549,6 +549,8 @@ void SimWindow::shift( VectorPatch &vecPatches, SmileiMPI *smpi, Params &params,
         {
             x_moved += cell_length_x_*params.patch_size_[0];
             vecPatches.updateFieldList( smpi ) ;
+            // MPI neighbors changed : persistent requests must be set up again
+            smpi->patch_layout_version++;
             //update list fields for species diag too ??
             
             // Tell that the patches moved this iteration (needed for probes)
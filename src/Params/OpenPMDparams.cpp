@@ -161,7 +161,7 @@ void OpenPMDparams::writeMeshesAttributes( H5Write &location )
     location.attr( "fieldSmoothingParameters", "" );
 }
 
-void OpenPMDparams::writeFieldAttributes( H5Write &location, vector<unsigned int> subgrid_start, vector<unsigned int> subgrid_step )
+void OpenPMDparams::writeFieldAttributes( H5Write &location, vector<unsigned int> subgrid_start, vector<unsigned int> subgrid_step, vector<unsigned int> coarsening )
 {
     location.attr( "geometry", "cartesian" );
     location.attr( "dataOrder", "C" );
@@ -176,6 +176,11 @@ void OpenPMDparams::writeFieldAttributes( H5Write &location, vector<unsigned int
         for( unsigned int i=0; i<ndim; i++ ) {
             subgridSpacing[i] = gridSpacing [i] * subgrid_step [i];
             subgridOffset [i] = gridSpacing [i] * subgrid_start[i];
+            // Coarsened points are located at the center of the averaged cells
+            if( i < coarsening.size() ) {
+                subgridSpacing[i] *= coarsening[i];
+                subgridOffset [i] += gridSpacing[i] * 0.5 * ( coarsening[i] - 1. );
+            }
         }
         location.attr( "gridSpacing", subgridSpacing );
         location.attr( "gridGlobalOffset", subgridOffset );
@@ -66,7 +66,7 @@ public:
     void writeParticlesAttributes( H5Write& );
     
     //! Write the attributes for a field in the meshesPath
-    void writeFieldAttributes( H5Write&, std::vector<unsigned int> subgrid_start= {}, std::vector<unsigned int> subgrid_step= {} );
+    void writeFieldAttributes( H5Write&, std::vector<unsigned int> subgrid_start= {}, std::vector<unsigned int> subgrid_step= {}, std::vector<unsigned int> coarsening= {} );
     
     //! Write the attributes for the particlesPath
     void writeSpeciesAttributes( H5Write& );
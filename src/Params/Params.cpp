@@ -89,6 +89,57 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     //for (unsigned int i=0;i<namelistsFiles.size();i++) commandLineStr+="\""+namelistsFiles[i]+"\" ";
     //MESSAGE(1,commandLineStr);
 
+    // Read the namelists on the master and broadcast them before starting python,
+    // so that the python startup below contains no collective communication
+    string command;
+    vector<string> strNamelists( namelistsFiles.size(), "" );
+    for( unsigned int i=0; i<namelistsFiles.size(); i++ ) {
+        if( smpi->isMaster() ) {
+            ifstream istr( namelistsFiles[i].c_str() );
+            // If file
+            if( istr.is_open() ) {
+                std::stringstream buffer;
+                buffer << istr.rdbuf();
+                strNamelists[i]+=buffer.str();
+                // If command
+            } else {
+                command = namelistsFiles[i];
+                // Remove quotes
+                unsigned int s = command.size();
+                if( s>1 && command.substr( 0, 1 )=="\"" && command.substr( s-1, 1 )=="\"" ) {
+                    command = command.substr( 1, s - 2 );
+                }
+                // Add to namelist
+                strNamelists[i] = Tools::merge( "# Smilei:) From command line:\n", command );
+            }
+            strNamelists[i] +="\n";
+        }
+        smpi->bcast( strNamelists[i] );
+    }
+
+    // With SMILEI_PYTHON_STARTUP=node, one process per node starts python first (imports
+    // and namelist evaluation), so that the other processes find the modules in the file-system
+    // cache of their node instead of all reading them from the shared file system at once
+    string python_startup = "all";
+    if( smpi->isMaster() && getenv( "SMILEI_PYTHON_STARTUP" ) ) {
+        python_startup = getenv( "SMILEI_PYTHON_STARTUP" );
+    }
+    smpi->bcast( python_startup );
+    if( python_startup != "all" && python_startup != "node" ) {
+        ERROR( "SMILEI_PYTHON_STARTUP must be `all` or `node`, not `" << python_startup << "`" );
+    }
+    int node_rank = 0;
+    if( python_startup == "node" ) {
+        MPI_Comm node_comm;
+        MPI_Comm_split_type( smpi->world(), MPI_COMM_TYPE_SHARED, smpi->getRank(), MPI_INFO_NULL, &node_comm );
+        MPI_Comm_rank( node_comm, &node_rank );
+        MPI_Comm_free( &node_comm );
+        // Wait for the node leaders
+        if( node_rank > 0 ) {
+            smpi->barrier();
+        }
+    }
+
     //init Python
     PyTools::openPython();
     // Print python version
@@ -112,7 +163,7 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     // First, we tell python to filter the ctrl-C kill command (or it would prevent to kill the code execution).
     // This is done separately from other scripts because we don't want it in the concatenated python namelist.
     PyTools::checkPyError();
-    string command = "import signal\nsignal.signal(signal.SIGINT, signal.SIG_DFL)";
+    command = "import signal\nsignal.signal(signal.SIGINT, signal.SIG_DFL)";
     if( !PyRun_SimpleString( command.c_str() ) ) {
         PyTools::checkPyError();
     }
@@ -150,30 +201,8 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     namelist += "\"\"\"\n\n";
 
     // Running the namelists
-    for( vector<string>::iterator it=namelistsFiles.begin(); it!=namelistsFiles.end(); it++ ) {
-        string strNamelist="";
-        if( smpi->isMaster() ) {
-            ifstream istr( it->c_str() );
-            // If file
-            if( istr.is_open() ) {
-                std::stringstream buffer;
-                buffer << istr.rdbuf();
-                strNamelist+=buffer.str();
-                // If command
-            } else {
-                command = *it;
-                // Remove quotes
-                unsigned int s = command.size();
-                if( s>1 && command.substr( 0, 1 )=="\"" && command.substr( s-1, 1 )=="\"" ) {
-                    command = command.substr( 1, s - 2 );
-                }
-                // Add to namelist
-                strNamelist = Tools::merge( "# Smilei:) From command line:\n", command );
-            }
-            strNamelist +="\n";
-        }
-        smpi->bcast( strNamelist );
-        runScript( strNamelist, ( *it ), globals );
+    for( unsigned int i=0; i<namelistsFiles.size(); i++ ) {
+        runScript( strNamelists[i], namelistsFiles[i], globals );
     }
 
     // Running pycontrol.py
@@ -184,6 +213,11 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     PyTools::runPyFunction( "preprocess" );
     PyErr_Clear();
 
+    // Release the other processes of the node
+    if( python_startup == "node" && node_rank == 0 ) {
+        smpi->barrier();
+    }
+
     smpi->barrier();
 
     // Error if no block Main() exists
@@ -191,6 +225,18 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         ERROR_NAMELIST( "Block Main() not defined",LINK_NAMELIST + std::string("#main-variables") );
     }
 
+    // Only the master lists the files of the restart directory
+    string restart_dir_listing( "" );
+    if( smpi->isMaster() ) {
+        PyTools::runPyFunction( "_list_restart_dir" );
+        PyTools::extract( "_restart_dir_listing", restart_dir_listing );
+    }
+    smpi->bcast( restart_dir_listing );
+    PyObject *py_listing = PyUnicode_FromString( restart_dir_listing.c_str() );
+    PyObject_SetAttrString( Py_main, "_restart_dir_listing", py_listing );
+    Py_DECREF( py_listing );
+    PyTools::checkPyError();
+
     // CHECK namelist on python side
     PyTools::runPyFunction( "_smilei_check" );
     smpi->barrier();
@@ -265,8 +311,12 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         is_pxr = true;
     }
 
-#ifndef _PICSAR
-    if (is_pxr) {
+#ifdef _PICSAR
+    use_picsar = is_pxr;
+#else
+    // Without picsar, the spectral solver is native in cartesian geometries
+    use_picsar = false;
+    if( is_pxr && ( maxwell_sol == "picsar" || geometry == "AMcylindrical" ) ) {
         ERROR_NAMELIST( "Smilei not linked with picsar, use make config=picsar", "https://smileipic.github.io/Smilei/install_PICSAR.html" );
     }
 #endif
@@ -313,6 +363,42 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     // if ( !PyTools::extract("exchange_particles_each", exchange_particles_each) )
     exchange_particles_each = 1;
 
+    PyTools::extract( "exchange_fields_each", exchange_fields_each, "Main"   );
+    if( exchange_fields_each < 1 ) {
+        ERROR_NAMELIST( "Main.exchange_fields_each must be at least 1", LINK_NAMELIST + std::string("#main-variables") );
+    }
+
+    std::string particle_exchange( "" );
+    PyTools::extract( "particle_exchange", particle_exchange, "Main"   );
+    if( particle_exchange != "per_direction" && particle_exchange != "all_neighbors" ) {
+        ERROR_NAMELIST( "Main.particle_exchange must be `per_direction` or `all_neighbors`", LINK_NAMELIST + std::string("#main-variables") );
+    }
+    all_neighbors_particle_exchange = ( particle_exchange == "all_neighbors" );
+    if( all_neighbors_particle_exchange ) {
+        // The neighborhood of the patches is fixed: no moving window, and the radial direction is not handled
+        if( geometry == "AMcylindrical" || PyTools::nComponents( "MovingWindow" ) > 0 ) {
+            ERROR_NAMELIST( "Main.particle_exchange = `all_neighbors` is not available in AMcylindrical geometry or with a MovingWindow", LINK_NAMELIST + std::string("#main-variables") );
+        }
+#if defined( SMILEI_ACCELERATOR_GPU_OMP ) || defined( SMILEI_OPENACC_MODE )
+        ERROR_NAMELIST( "Main.particle_exchange = `all_neighbors` is not available on GPU", LINK_NAMELIST + std::string("#main-variables") );
+#endif
+    }
+
+    PyTools::extract( "persistent_field_communications", persistent_field_communications, "Main"   );
+
+    PyObject *py_aggregation = PyTools::extract_py( "diagnostics_io_aggregation", "Main" );
+    std::string aggregation( "" );
+    if( PyTools::py2scalar( py_aggregation, diagnostics_io_aggregation ) ) {
+        if( diagnostics_io_aggregation < 1 ) {
+            ERROR_NAMELIST( "Main.diagnostics_io_aggregation must be a positive number of MPI processes", LINK_NAMELIST + std::string("#main-variables") );
+        }
+    } else if( PyTools::py2scalar( py_aggregation, aggregation ) && ( aggregation == "none" || aggregation == "node" ) ) {
+        diagnostics_io_aggregation = ( aggregation == "node" ) ? -1 : 0;
+    } else {
+        ERROR_NAMELIST( "Main.diagnostics_io_aggregation must be `none`, `node` or a number of MPI processes", LINK_NAMELIST + std::string("#main-variables") );
+    }
+    Py_DECREF( py_aggregation );
+
     PyTools::extract( "every_clean_particles_overhead", every_clean_particles_overhead, "Main"   );
 
     // TIME & SPACE RESOLUTION/TIME-STEPS
@@ -902,17 +988,14 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
                 }
             }
         }
-        //Use cell sorting if merge is used.
+        // Merging works on species sorted per cell (vectorized) or per bin (scalar),
+        // but not on species switching between both sortings
         PyTools::extract( "merging_method", merging_method, "Species", ispec );
-        if (merging_method != "none"){
-
-            if (defined_cell_sort && !cell_sorting_){
-                ERROR_NAMELIST(" Cell sorting or vectorization must be allowed in order to use particle merging.",  LINK_NAMELIST + std::string("#collisions-reactions"));
-            }
-
-            // Force cell sorting and later the adaptive vectorization mode in scalar mode
-            cell_sorting_ = true;
-
+        if( merging_method != "none" && vectorization_mode == "adaptive_mixed_sort" ) {
+            ERROR_NAMELIST( "Particle merging is incompatible with the vectorization mode 'adaptive_mixed_sort'.",  LINK_NAMELIST + std::string("#particle-merging") );
+        }
+        if( merging_method != "none" && gpu_computing ) {
+            ERROR_NAMELIST( "Particle merging is not available on GPU.",  LINK_NAMELIST + std::string("#particle-merging") );
         }
     }
 
@@ -920,7 +1003,7 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     if ( cell_sorting_ ) {
 
         if( vectorization_mode == "adaptive_mixed_sort" ) {
-            ERROR_NAMELIST( "Cell sorting (required by Collision or Merging) is incompatible with the vectorization mode 'adaptive_mixed_sort'.",  LINK_NAMELIST + std::string("#vectorization") );
+            ERROR_NAMELIST( "Cell sorting (required by Collisions) is incompatible with the vectorization mode 'adaptive_mixed_sort'.",  LINK_NAMELIST + std::string("#vectorization") );
         } else if ( vectorization_mode == "off" ) {
             vectorization_mode            = "adaptive";
             has_adaptive_vectorization    = true;
@@ -1195,6 +1278,20 @@ void Params::compute()
         cell_length[i]=0.0;
     }
 
+    // Exchanging the fields less often requires that the ghost cells are computed redundantly,
+    // which is only possible for the Yee scheme with a local stencil and no field filter
+    if( exchange_fields_each > 1 ) {
+        if( maxwell_sol != "Yee" || multiple_decomposition || geometry == "AMcylindrical" ) {
+            ERROR_NAMELIST( "Main.exchange_fields_each > 1 requires the `Yee` solver in cartesian geometry", LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( Friedman_filter || PyTools::nComponents( "MovingWindow" ) > 0 ) {
+            ERROR_NAMELIST( "Main.exchange_fields_each > 1 is not compatible with FieldFilter or MovingWindow", LINK_NAMELIST + std::string("#main-variables") );
+        }
+        // Components which are usually recomputed locally in the ghost cells (E, and B primal
+        // in the exchange direction) become invalid after a few steps: all of them are exchanged
+        full_B_exchange = true;
+    }
+
     //Define number of cells per patch and number of ghost cells
     for( unsigned int i=0; i<nDim_field; i++ ) {
         PyTools::extract( "custom_oversize", custom_oversize, "Main"  );
@@ -1202,7 +1299,7 @@ void Params::compute()
              ERROR_NAMELIST( "With `Bouchard` solver the oversize have to be greater than 4", LINK_NAMELIST + std::string("#main-variables") );
         }
         if( ! multiple_decomposition ) {
-            oversize[i]  = std::max( interpolation_order, std::max( ( unsigned int )( spectral_solver_order[i]/2+1 ),custom_oversize ) ) + ( exchange_particles_each-1 );
+            oversize[i]  = std::max( interpolation_order, std::max( ( unsigned int )( spectral_solver_order[i]/2+1 ),custom_oversize ) ) + ( exchange_particles_each-1 ) + ( exchange_fields_each-1 );
             if( currentFilter_model == "customFIR" && oversize[i] < (currentFilter_kernelFIR.size()-1)/2 ) {
                 ERROR_NAMELIST( "With the `customFIR` current filter model, the ghost cell number (oversize) = " << oversize[i] << " have to be >= " << (currentFilter_kernelFIR.size()-1)/2 << ", the (kernelFIR size - 1)/2", LINK_NAMELIST + std::string("#current-filtering")  );
             }
@@ -81,6 +81,12 @@ public:
     {
         return ( current_timestep % print_every == 0 );
     }
+    
+    //! Returns true if the field ghost cells must be exchanged at this timestep
+    bool exchangeFieldsNow( int current_timestep )
+    {
+        return ( current_timestep % exchange_fields_each == 0 );
+    }
 
     //! sets nDim_particle and nDim_field based on the geometry
     void setDimensions();
@@ -264,6 +270,18 @@ public:
     //! frequency of exchange particles (default = 1, disabled for now, incompatible with sort)
     int exchange_particles_each;
     
+    //! frequency of the exchange of the field ghost cells (deep halos computed redundantly in between)
+    int exchange_fields_each;
+
+    //! exchange particles directly with all the neighbor patches (including corners) in a single round of messages
+    bool all_neighbors_particle_exchange;
+    
+    //! reuse persistent MPI requests for the field exchanges and sums between MPI processes
+    bool persistent_field_communications;
+    
+    //! number of MPI processes per I/O aggregator of the diagnostics (0 = MPI-IO defaults, -1 = one per node)
+    int diagnostics_io_aggregation;
+    
     //! frequency to apply shrinkToFit on particles structure
     int every_clean_particles_overhead;
 
@@ -345,6 +363,8 @@ public:
     // PXR parameters
     bool  is_spectral;
     bool  is_pxr;
+    //! True if the spectral solver is provided by the picsar library, false for the native one
+    bool  use_picsar;
     std::vector<int> spectral_solver_order;
 
     //! Boolean for printing the expected disk usage or not
@@ -150,6 +150,9 @@ int ParticleCreator::create( struct SubSpace sub_space,
     // fields containing the profiles values in each cell (always 3d)
     Field3D charge, n_part_in_cell, density, temperature[3], velocity[3];
 
+    // Profiles may call python, which is not thread-safe: they are evaluated in critical sections
+    // as particles can be created by several threads (e.g. injection, patch creation)
+
     // MOMENTUM PROFILE
     if( species_->momentum_initialization_array_ == NULL
      && species_->file_momentum_npart_ == 0 ) {
@@ -157,14 +160,14 @@ int ParticleCreator::create( struct SubSpace sub_space,
         for( unsigned int m=0; m<3; m++ ) {
             temperature[m].allocateDims( n_space_to_create );
             if( temperature_profile_[m] ) {
-                temperature_profile_[m]->valuesAt( xyz, global_origin, temperature[m] );
+                profileValuesAt( temperature_profile_[m], xyz, global_origin, temperature[m] );
             } else {
                 temperature[m].put_to( 0.0000000001 ); // default value
             }
 
             velocity[m].allocateDims( n_space_to_create );
             if( velocity_profile_[m] ) {
-                velocity_profile_[m]->valuesAt( xyz, global_origin, velocity[m] );
+                profileValuesAt( velocity_profile_[m], xyz, global_origin, velocity[m] );
             } else {
                 velocity[m].put_to( 0.0 ); //default value
             }
@@ -178,7 +181,7 @@ int ParticleCreator::create( struct SubSpace sub_space,
     charge.allocateDims( n_space_to_create );
     if( species_->mass_ > 0 ) {
         // Initialize charge profile
-        species_->charge_profile_->valuesAt( xyz, global_origin, charge );
+        profileValuesAt( species_->charge_profile_, xyz, global_origin, charge );
         // Find max charge
         for( unsigned int i=0; i< sub_space.box_size_[0]; i++ ) {
             for( unsigned int j=0; j< sub_space.box_size_[1]; j++ ) {
@@ -201,11 +204,12 @@ int ParticleCreator::create( struct SubSpace sub_space,
         // Get density and ppc profiles
         density.allocateDims( n_space_to_create );
         n_part_in_cell.allocateDims( n_space_to_create );
-        density_profile_->valuesAt( xyz, global_origin, density );
-        particles_per_cell_profile_->valuesAt( xyz, global_origin, n_part_in_cell );
-        // Take into account the time profile
+        // Take into account the time profile (for injectors)
         double time_amplitude = 1.;
+        profileValuesAt( density_profile_, xyz, global_origin, density );
+        profileValuesAt( particles_per_cell_profile_, xyz, global_origin, n_part_in_cell );
         if( time_profile_ ) {
+            #pragma omp critical
             time_amplitude = time_profile_->valueAt( itime*params.timestep );
         }
         // Loop cells
@@ -609,6 +613,20 @@ void ParticleCreator::createChargeProfile( struct SubSpace sub_space,
 } // end createChargeProfile
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Evaluation of a profile, in a critical section if it calls python or reads a file
+// ---------------------------------------------------------------------------------------------------------------------
+void ParticleCreator::profileValuesAt( Profile *profile, std::vector<Field *> &xyz, std::vector<double> &global_origin, Field &values )
+{
+    if( profile->threadSafe() ) {
+        profile->valuesAt( xyz, global_origin, values );
+    } else {
+        #pragma omp critical
+        profile->valuesAt( xyz, global_origin, values );
+    }
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 //! Creation of the position for all particles (nPart)
 // ---------------------------------------------------------------------------------------------------------------------
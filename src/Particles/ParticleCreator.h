@@ -56,6 +56,9 @@ public:
     void createChargeProfile( struct SubSpace n_space_to_create,
                 Patch *patch);
     
+    //! Evaluation of a profile, in a critical section if it calls python or reads a file
+    static void profileValuesAt( Profile *profile, std::vector<Field *> &xyz, std::vector<double> &global_origin, Field &values );
+    
     //! Creation of the particle positions
     static void createPosition( std::string position_initialization,
                               std::vector<int> regular_number_array,
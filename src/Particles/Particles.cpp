@@ -674,19 +674,44 @@ void Particles::swapParticle4( unsigned int part1, unsigned int part2, unsigned
 }
 
 
-void Particles::swapParticles( std::vector<unsigned int> parts )
+void Particles::swapParticles( const std::vector<unsigned int> &parts )
 {
     // parts[0] ==> parts[1] ==> parts[2] ==> parts[parts.size()-1] ==> parts[0]
+    // The rotation is done in place, property by property, without changing the size of the arrays
 
-    copyParticle( parts.back() );
-    translateParticles( parts );
-    overwriteParticle( size()-1, parts[0] );
-    eraseParticle( size()-1 );
+    const int last = parts.size()-1;
+
+    for( unsigned int iprop=0 ; iprop<double_prop_.size() ; iprop++ ) {
+        std::vector<double> &prop = *double_prop_[iprop];
+        const double temp = prop[parts[last]];
+        for( int icycle = last-1; icycle >=0; icycle-- ) {
+            prop[parts[icycle+1]] = prop[parts[icycle]];
+        }
+        prop[parts[0]] = temp;
+    }
+
+    for( unsigned int iprop=0 ; iprop<short_prop_.size() ; iprop++ ) {
+        std::vector<short> &prop = *short_prop_[iprop];
+        const short temp = prop[parts[last]];
+        for( int icycle = last-1; icycle >=0; icycle-- ) {
+            prop[parts[icycle+1]] = prop[parts[icycle]];
+        }
+        prop[parts[0]] = temp;
+    }
+
+    for( unsigned int iprop=0 ; iprop<uint64_prop_.size() ; iprop++ ) {
+        std::vector<uint64_t> &prop = *uint64_prop_[iprop];
+        const uint64_t temp = prop[parts[last]];
+        for( int icycle = last-1; icycle >=0; icycle-- ) {
+            prop[parts[icycle+1]] = prop[parts[icycle]];
+        }
+        prop[parts[0]] = temp;
+    }
 
 }
 
 
-void Particles::translateParticles( std::vector<unsigned int> parts )
+void Particles::translateParticles( const std::vector<unsigned int> &parts )
 {
     // parts[0] ==> parts[1] ==> parts[2] ==> parts[parts.size()-1]
 
@@ -162,8 +162,8 @@ public:
 
     //! Exchange particles part1 & part2 memory location
     void swapParticle( unsigned int part1, unsigned int part2 );
-    void swapParticles( std::vector<unsigned int> parts );
-    void translateParticles( std::vector<unsigned int> parts );
+    void swapParticles( const std::vector<unsigned int> &parts );
+    void translateParticles( const std::vector<unsigned int> &parts );
     void swapParticle3( unsigned int part1, unsigned int part2, unsigned int part3 );
     void swapParticle4( unsigned int part1, unsigned int part2, unsigned int part3, unsigned int part4 );
 
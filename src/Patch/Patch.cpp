@@ -510,8 +510,55 @@ void Patch::updateMPIenv( SmileiMPI *smpi )
 //            }
         }
 
+    for( unsigned int iNbr=0 ; iNbr<all_neighbor_.size() ; iNbr++ ) {
+        all_MPI_neighbor_[iNbr] = smpi->hrank( all_neighbor_[iNbr] );
+    }
+
 } // END updateMPIenv
 
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute the hilbert index of all the patches sharing a face, an edge or a corner with the current patch
+//   - neighbor iNbr is at relative coordinates ( iNbr%3-1, (iNbr/3)%3-1, (iNbr/9)%3-1 )
+//   - the central index (current patch) is set to MPI_PROC_NULL
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::initAllNeighbors( Params &params, DomainDecomposition *domain_decomposition )
+{
+    if( ! params.all_neighbors_particle_exchange ) {
+        return;
+    }
+
+    int nnbr = 1;
+    for( int iDim = 0 ; iDim < nDim_fields_ ; iDim++ ) {
+        nnbr *= 3;
+    }
+    all_neighbor_.assign( nnbr, MPI_PROC_NULL );
+    all_MPI_neighbor_.assign( nnbr, MPI_PROC_NULL );
+
+    std::vector<int> xcall( nDim_fields_, 0 );
+    for( int iNbr = 0 ; iNbr < nnbr ; iNbr++ ) {
+        if( iNbr == nnbr/2 ) {
+            continue;
+        }
+        bool exists = true;
+        int stride = 1;
+        for( int iDim = 0 ; iDim < nDim_fields_ ; iDim++ ) {
+            int ndomain = domain_decomposition->ndomain_[iDim];
+            xcall[iDim] = Pcoordinates[iDim] + ( iNbr/stride )%3 - 1;
+            if( params.EM_BCs[iDim][0]=="periodic" ) {
+                xcall[iDim] = ( xcall[iDim] + ndomain ) % ndomain;
+            } else if( xcall[iDim] < 0 || xcall[iDim] >= ndomain ) {
+                exists = false;
+            }
+            stride *= 3;
+        }
+        if( exists ) {
+            all_neighbor_[iNbr] = domain_decomposition->getDomainId( xcall );
+        }
+    }
+
+} // END initAllNeighbors
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Clean the MPI buffers for communications
 // ---------------------------------------------------------------------------------------------------------------------
@@ -905,6 +952,132 @@ void Patch::cornersParticles( int ispec, Params &params, int iDim )
     } //loop i Neighbor
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// all_neighbors exchange : particles are sent directly to the neighbor they go to, corners included.
+// Messages are sent to all MPI neighbors, even empty: the number of particles is deduced from their size,
+// there is no need for a previous exchange of the number of particles.
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::initExchParticlesAllNeighbors( int ispec, Params &params )
+{
+    Particles &cuParticles = ( *vecSpecies[ispec]->particles_to_move );
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    int ndim = params.nDim_field;
+
+    for( int iDim=0 ; iDim < ndim ; iDim++ ) {
+        for( int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++ ) {
+            buffer.partRecv[iDim][iNeighbor].clear();
+            buffer.part_index_recv_sz[iDim][iNeighbor] = 0;
+        }
+    }
+    for( unsigned int iNbr=0 ; iNbr<all_neighbor_.size() ; iNbr++ ) {
+        buffer.partRecvNbr[iNbr].clear();
+        buffer.partSendNbr[iNbr].clear();
+        buffer.part_index_send_nbr[iNbr].resize( 0 );
+    }
+
+    int n_part_send = cuParticles.size();
+
+    // Define where particles are going : index of the neighbor, built from the relative position along each direction
+    for( int iPart=0 ; iPart<n_part_send ; iPart++ ) {
+        int iNbr = 0;
+        int stride = 1;
+        for( int idim=0 ; idim<ndim ; idim++ ) {
+            if( cuParticles.position( idim, iPart ) >= max_local_[idim] ) {
+                iNbr += 2*stride;
+            } else if( cuParticles.position( idim, iPart ) >= min_local_[idim] ) {
+                iNbr += stride;
+            }
+            stride *= 3;
+        }
+        //If particle is outside of the global domain (has no neighbor), it will not be put in a send buffer and will simply be deleted.
+        if( all_neighbor_[iNbr]!=MPI_PROC_NULL ) {
+            buffer.part_index_send_nbr[iNbr].push_back( iPart );
+        }
+    }
+
+} // END initExchParticlesAllNeighbors
+
+
+void Patch::prepareParticlesAllNeighbors( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch )
+{
+    Particles &cuParticles = ( *vecSpecies[ispec]->particles_to_move );
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    int ndim = params.nDim_field;
+    int h0 = ( *vecPatch )( 0 )->hindex;
+    int nnbr = all_neighbor_.size();
+
+    for( int iNbr=0 ; iNbr<nnbr ; iNbr++ ) {
+        int n_part_send = buffer.part_index_send_nbr[iNbr].size();
+        if( n_part_send==0 ) {
+            continue;
+        }
+        // Enabled periodicity
+        int stride = 1;
+        for( int idim=0 ; idim<ndim ; idim++ ) {
+            int offset = ( iNbr/stride )%3 - 1;
+            stride *= 3;
+            if( smpi->periods_[idim]!=1 || offset==0 ) {
+                continue;
+            }
+            double x_max = params.cell_length[idim]*( params.global_size_[idim] );
+            for( int iPart=0 ; iPart<n_part_send ; iPart++ ) {
+                int ipart = buffer.part_index_send_nbr[iNbr][iPart];
+                if( ( offset==-1 ) && ( Pcoordinates[idim] == 0 ) && ( cuParticles.position( idim, ipart ) < 0. ) ) {
+                    cuParticles.position( idim, ipart ) += x_max;
+                } else if( ( offset==1 ) && ( Pcoordinates[idim] == params.number_of_patches[idim]-1 ) && ( cuParticles.position( idim, ipart ) >= x_max ) ) {
+                    cuParticles.position( idim, ipart ) -= x_max;
+                }
+            }
+        }
+        if( all_MPI_neighbor_[iNbr]!=MPI_me_ ) {
+            // If MPI comm, first copy particles in the sendbuffer
+            for( int iPart=0 ; iPart<n_part_send ; iPart++ ) {
+                cuParticles.copyParticle( buffer.part_index_send_nbr[iNbr][iPart], buffer.partSendNbr[iNbr] );
+            }
+        } else {
+            //If not MPI comm, copy particles directly in the receive buffer (the neighbor sees the current patch at nnbr-1-iNbr)
+            Particles &recv = ( *vecPatch )( all_neighbor_[iNbr]-h0 )->vecSpecies[ispec]->MPI_buffer_.partRecvNbr[nnbr-1-iNbr];
+            for( int iPart=0 ; iPart<n_part_send ; iPart++ ) {
+                cuParticles.copyParticle( buffer.part_index_send_nbr[iNbr][iPart], recv );
+            }
+        }
+    }
+
+} // END prepareParticlesAllNeighbors
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Received particles are stored, as in the per direction exchange, in partRecv[iDim][iNeighbor]
+// where iDim is the last direction along which they crossed the patch border.
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::mergeParticlesAllNeighbors( int ispec, Params &params )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    int ndim = params.nDim_field;
+
+    for( unsigned int iNbr=0 ; iNbr<all_neighbor_.size() ; iNbr++ ) {
+        int n_part_recv = buffer.partRecvNbr[iNbr].size();
+        if( n_part_recv==0 ) {
+            continue;
+        }
+        int iDim = 0;
+        int iNeighbor = 0;
+        int stride = 1;
+        for( int idim=0 ; idim<ndim ; idim++ ) {
+            int offset = ( iNbr/stride )%3 - 1;
+            if( offset != 0 ) {
+                iDim = idim;
+                iNeighbor = ( offset+1 )/2;
+            }
+            stride *= 3;
+        }
+        buffer.partRecvNbr[iNbr].copyParticles( 0, n_part_recv, buffer.partRecv[iDim][iNeighbor], buffer.partRecv[iDim][iNeighbor].size() );
+        buffer.part_index_recv_sz[iDim][iNeighbor] += n_part_recv;
+    }
+
+} // END mergeParticlesAllNeighbors
+
+
 //! Import particles exchanged with surrounding patches/mpi and sort at the same time
 void Patch::importAndSortParticles( int ispec, Params &params )
 {
@@ -939,8 +1112,35 @@ void Patch::cleanParticlesOverhead( Params &params )
                 vector<int>( vecSpecies[ispec]->MPI_buffer_.part_index_send[idim][iNeighbor] ).swap( vecSpecies[ispec]->MPI_buffer_.part_index_send[idim][iNeighbor] );
             }
         }
+        for( unsigned int iNbr = 0; iNbr < vecSpecies[ispec]->MPI_buffer_.partRecvNbr.size(); iNbr++ ) {
+            vecSpecies[ispec]->MPI_buffer_.partRecvNbr[iNbr].clear();
+            vecSpecies[ispec]->MPI_buffer_.partRecvNbr[iNbr].shrinkToFit( );
+            vecSpecies[ispec]->MPI_buffer_.partSendNbr[iNbr].clear();
+            vecSpecies[ispec]->MPI_buffer_.partSendNbr[iNbr].shrinkToFit( );
+            vecSpecies[ispec]->MPI_buffer_.part_index_send_nbr[iNbr].clear();
+            vector<int>( vecSpecies[ispec]->MPI_buffer_.part_index_send_nbr[iNbr] ).swap( vecSpecies[ispec]->MPI_buffer_.part_index_send_nbr[iNbr] );
+        }
 
         cuParticles.shrinkToFit(  );
+
+#ifndef SMILEI_ACCELERATOR_MODE
+        // Release the buffers of the particles created by QED processes and ionization
+        Species *spec = vecSpecies[ispec];
+        if( spec->radiated_photons_ ) {
+            spec->radiated_photons_->clear();
+            spec->radiated_photons_->shrinkToFit( true );
+        }
+        for( int k=0; k<2; k++ ) {
+            if( spec->mBW_pair_particles_[k] ) {
+                spec->mBW_pair_particles_[k]->clear();
+                spec->mBW_pair_particles_[k]->shrinkToFit( true );
+            }
+        }
+        if( spec->Ionize ) {
+            spec->Ionize->new_electrons.clear();
+            spec->Ionize->new_electrons.shrinkToFit( true );
+        }
+#endif
     }
 
 }
@@ -1003,6 +1203,49 @@ void Patch::cleanupSentParticles( int ispec, std::vector<int> *indexes_of_partic
 } // END cleanupSentParticles
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Exchanges and sums of a field send the same buffers to the same neighbors at each call :
+// the requests are set up once (MPI_Send_init, MPI_Recv_init) for all directions, then only started.
+// They are set up again once patches moved (SmileiMPI::patch_layout_version changed).
+// finalizeExchange and finalizeSumField are unchanged : MPI_Wait leaves persistent requests inactive.
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::startPersistentRequests( Field *field, int iDim, SmileiMPI *smpi )
+{
+    AsyncMPIbuffers &buff = field->MPIbuff;
+
+    if( buff.persistent_version_ != smpi->patch_layout_version ) {
+        if( buff.persistent_version_ ) {
+            buff.freePersistentRequests();
+        }
+        for( int jDim=0 ; jDim<nDim_fields_ ; jDim++ ) {
+            for( int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++ ) {
+                if( is_a_MPI_neighbor( jDim, iNeighbor ) ) {
+                    MPI_Send_init( field->sendFields_[jDim*2+iNeighbor]->data_, field->sendFields_[jDim*2+iNeighbor]->size(),
+                                   MPI_DOUBLE, MPI_neighbor_[jDim][iNeighbor], buff.send_tags_[jDim][iNeighbor],
+                                   MPI_COMM_WORLD, &( buff.srequest[jDim][iNeighbor] ) );
+                }
+                if( is_a_MPI_neighbor( jDim, ( iNeighbor+1 )%2 ) ) {
+                    MPI_Recv_init( field->recvFields_[jDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[jDim*2+(iNeighbor+1)%2]->size(),
+                                   MPI_DOUBLE, MPI_neighbor_[jDim][( iNeighbor+1 )%2], buff.recv_tags_[jDim][iNeighbor],
+                                   MPI_COMM_WORLD, &( buff.rrequest[jDim][( iNeighbor+1 )%2] ) );
+                }
+            }
+        }
+        buff.persistent_version_ = smpi->patch_layout_version;
+    }
+
+    for( int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++ ) {
+        if( is_a_MPI_neighbor( iDim, iNeighbor ) ) {
+            MPI_Start( &( buff.srequest[iDim][iNeighbor] ) );
+        }
+        if( is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
+            MPI_Start( &( buff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+        }
+    }
+
+} // END startPersistentRequests
+
+
 void Patch::initExchange( Field *field, int iDim, SmileiMPI *smpi, bool devPtr )
 {
     if( field->MPIbuff.srequest.size()==0 ) {
@@ -1022,6 +1265,11 @@ void Patch::initExchange( Field *field, int iDim, SmileiMPI *smpi, bool devPtr )
         field->MPIbuff.defineTags( this, smpi, tagp );
     }
 
+    if( smpi->persistent_field_requests && !devPtr ) {
+        startPersistentRequests( field, iDim, smpi );
+        return;
+    }
+
     for( int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++ ) {
 
         if( is_a_MPI_neighbor( iDim, iNeighbor ) ) {
@@ -1141,6 +1389,11 @@ void Patch::initSumField( Field *field, int iDim, SmileiMPI *smpi, bool devPtr )
         field->MPIbuff.defineTags( this, smpi, tagp );
     }
 
+    if( smpi->persistent_field_requests && !devPtr ) {
+        startPersistentRequests( field, iDim, smpi );
+        return;
+    }
+
     int patch_nbNeighbors_( 2 );
 
     /********************************************************************************/
@@ -41,6 +41,7 @@ class Patch
     friend class SimWindow;
     friend class SyncVectorPatch;
     friend class AsyncMPIbuffers;
+    friend class ParticlesRankMPIbuffers;
 public:
     //! Constructor for Patch
     Patch( Params &params, SmileiMPI *smpi, DomainDecomposition *domain_decomposition, unsigned int ipatch );
@@ -187,6 +188,12 @@ public:
     void finalizeExchParticles( int ispec, int iDim );
     //! Treat diagonalParticles
     void cornersParticles( int ispec, Params &params, int iDim );
+    //! all_neighbors exchange: manage Idx of particles per neighbor (corners included)
+    void initExchParticlesAllNeighbors( int ispec, Params &params );
+    //! all_neighbors exchange: apply periodicity, copy particles in the send buffers or directly in local neighbors
+    void prepareParticlesAllNeighbors( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch );
+    //! all_neighbors exchange: gather received particles in the per direction buffers used by the sort
+    void mergeParticlesAllNeighbors( int ispec, Params &params );
     //! inject particles received in main data structure and particles sorting
     void importAndSortParticles( int ispec, Params &params );
     //! clean memory resizing particles structure
@@ -224,6 +231,8 @@ public:
     virtual void initExchangeComplex( Field *field, int iDim, SmileiMPI *smpi );
     //! finalize comm / exchange fields
     virtual void finalizeExchange( Field *field, int iDim );
+    //! init comm / exchange or sum fields in direction iDim with persistent requests, set up if required
+    void startPersistentRequests( Field *field, int iDim, SmileiMPI *smpi );
     
     virtual void exchangeField_movewin ( Field* field, int clrw ) = 0;
     
@@ -468,6 +477,14 @@ protected:
     //! MPI rank of neighbors patch
     std::vector< std::vector<int> > MPI_neighbor_, tmp_MPI_neighbor_;
     
+    //! Hilbert index of all neighbors patch, corners included (3^ndim, used by the all_neighbors particle exchange)
+    std::vector<int> all_neighbor_;
+    //! MPI rank of all neighbors patch, corners included
+    std::vector<int> all_MPI_neighbor_;
+    
+    //! Compute all_neighbor_ (corners included) if required by the particle exchange
+    void initAllNeighbors( Params &params, DomainDecomposition *domain_decomposition );
+    
     //! "Real" min limit of local sub-subdomain (ghost data not concerned)
     //!     - "0." on rank 0
     std::vector<double> min_local_;
@@ -73,6 +73,8 @@ void Patch1D::initStep2( Params &params, DomainDecomposition *domain_decompositi
         ntype_[ix_isPrim] = MPI_DATATYPE_NULL;
     }
     
+    initAllNeighbors( params, domain_decomposition );
+    
 }
 
 Patch1D::~Patch1D()
@@ -98,6 +98,8 @@ void Patch2D::initStep2( Params &params, DomainDecomposition *domain_decompositi
     //cout << "Nei\t"  << neighbor_[0][0] << "\t" << hindex << "\t" << neighbor_[0][1] << endl;
     //cout << "Nei\t"  << "\t" << neighbor_[1][0] << endl;
     
+    initAllNeighbors( params, domain_decomposition );
+    
 }
 
 
@@ -121,6 +121,8 @@ void Patch3D::initStep2( Params &params, DomainDecomposition *domain_decompositi
         }
     }
     
+    initAllNeighbors( params, domain_decomposition );
+    
 }
 
 
@@ -52,9 +52,12 @@ public:
         return nullptr;
     }
     
-    // Create a vector of patches
-    static void createVector( VectorPatch &vecPatches, Params &params, SmileiMPI *smpi, OpenPMDparams &openPMD, RadiationTables * radiation_tables_, unsigned int itime, unsigned int n_moved=0 )
+    // Create a vector of patches (the initialization phases are timed if timers are given)
+    static void createVector( VectorPatch &vecPatches, Params &params, SmileiMPI *smpi, OpenPMDparams &openPMD, RadiationTables * radiation_tables_, unsigned int itime, unsigned int n_moved=0, Timers *timers=nullptr )
     {
+        if( timers ) {
+            timers->initPatches.restart();
+        }
     
         vecPatches.diag_flag = ( params.restart? false : true );
         vecPatches.lastIterationPatchesMoved = itime;
@@ -80,6 +83,17 @@ public:
         TITLE( "Initializing Patches" );
         MESSAGE( 1, "First patch created" );
         
+        // The particles of the cloned patches are created afterwards, in parallel over patches,
+        // unless some species are initialized from numpy arrays or files
+        bool parallel_particles = ! params.restart;
+        for( unsigned int ispec=0 ; ispec<vecPatches( 0 )->vecSpecies.size(); ispec++ ) {
+            Species * s = vecPatches.patches_[0]->vecSpecies[ispec];
+            if( s->position_initialization_array_ || s->momentum_initialization_array_
+             || s->file_position_npart_ > 0 || s->file_momentum_npart_ > 0 ) {
+                parallel_particles = false;
+            }
+        }
+        
         // If normal mode (not test mode) clone the first patch to create the others
         unsigned int percent=10;
         for( unsigned int ipatch = 1 ; ipatch < npatches ; ipatch++ ) {
@@ -87,7 +101,26 @@ public:
                 MESSAGE( 2, "Approximately "<<percent<<"% of patches created" );
                 percent += 10;
             }
-            vecPatches.patches_[ipatch] = clone( vecPatches( 0 ), params, smpi, vecPatches.domain_decomposition_, firstpatch + ipatch, n_moved );
+            vecPatches.patches_[ipatch] = clone( vecPatches( 0 ), params, smpi, vecPatches.domain_decomposition_, firstpatch + ipatch, n_moved, ! parallel_particles );
+        }
+        
+        if( parallel_particles && npatches > 1 ) {
+            MESSAGE( 1, "Creating particles" );
+            if( timers ) {
+                timers->initPatches.update();
+                timers->initParticles.restart();
+            }
+            #pragma omp parallel for schedule( dynamic )
+            for( unsigned int ipatch = 1 ; ipatch < npatches ; ipatch++ ) {
+                Patch *patch = vecPatches.patches_[ipatch];
+                for( unsigned int ispec=0 ; ispec<patch->vecSpecies.size(); ispec++ ) {
+                    patch->vecSpecies[ispec]->initParticles( params, patch );
+                }
+            }
+            if( timers ) {
+                timers->initParticles.update();
+                timers->initPatches.restart();
+            }
         }
         
         // Clean numpy/HDF5 arrays for particle initialization
@@ -120,9 +153,20 @@ public:
         vecPatches.setRefHindex();
         
         vecPatches.updateFieldList( smpi );
+        if( params.all_neighbors_particle_exchange ) {
+            vecPatches.particles_rank_buffers_.build( vecPatches, smpi );
+        }
         
         TITLE( "Creating Diagnostics, antennas, and external fields" )
+        if( timers ) {
+            timers->initPatches.update();
+            timers->initDiags.restart();
+        }
         vecPatches.createDiags( params, smpi, openPMD, radiation_tables_ );
+        if( timers ) {
+            timers->initDiags.update();
+            timers->initPatches.restart();
+        }
         
         TITLE( "Finalize MPI environment" )
         for( unsigned int ipatch = 0 ; ipatch < npatches ; ipatch++ ) {
@@ -133,10 +177,19 @@ public:
         
         // Figure out if there are antennas
         vecPatches.nAntennas = vecPatches( 0 )->EMfields->antennas.size();
+        if( timers ) {
+            timers->initPatches.update();
+        }
         
         // Initialize lasers and antennas
         if( ! smpi->test_mode ) {
+            if( timers ) {
+                timers->initFields.restart();
+            }
             vecPatches.initExternals( params );
+            if( timers ) {
+                timers->initFields.update();
+            }
         }
         
         MESSAGE( 1, "Done creating diagnostics, antennas, and external fields" );
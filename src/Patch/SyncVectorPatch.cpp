@@ -32,7 +32,21 @@ void SyncVectorPatch::exchangeParticles( VectorPatch &vecPatches, int ispec, Par
         // Leaving particles are put in a buffer called particle_to_move
         // On GPU, particle_to_move is built and bring back to the CPU here
         spec->extractParticles();
-        vecPatches( ipatch )->initExchParticles( ispec, params );
+        if( params.all_neighbors_particle_exchange ) {
+            vecPatches( ipatch )->initExchParticlesAllNeighbors( ispec, params );
+        } else {
+            vecPatches( ipatch )->initExchParticles( ispec, params );
+        }
+    }
+
+    // Particles are sent to all neighbors (corners included) in one step, no exchange of their number
+    // Messages are sent for all species at once in exchangeParticlesAllSpecies
+    if( params.all_neighbors_particle_exchange ) {
+        #pragma omp for schedule(runtime)
+        for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+            vecPatches( ipatch )->prepareParticlesAllNeighbors( smpi, ispec, params, &vecPatches );
+        }
+        return;
     }
 
     // Init comm in direction 0
@@ -54,20 +68,28 @@ void SyncVectorPatch::exchangeParticles( VectorPatch &vecPatches, int ispec, Par
 // ---------------------------------------------------------------------------------------------------------------------
 void SyncVectorPatch::finalizeAndSortParticles( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi )
 {
-    SyncVectorPatch::finalizeExchangeParticles( vecPatches, ispec, 0, params, smpi );
+    if( params.all_neighbors_particle_exchange ) {
+        // Particles have been received in finalizeExchangeParticlesAllSpecies
+        #pragma omp for schedule(runtime)
+        for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+            vecPatches( ipatch )->mergeParticlesAllNeighbors( ispec, params );
+        }
+    } else {
+        SyncVectorPatch::finalizeExchangeParticles( vecPatches, ispec, 0, params, smpi );
 
-    // Per direction
-    for( unsigned int iDim=1 ; iDim<params.nDim_field ; iDim++ ) {
+        // Per direction
+        for( unsigned int iDim=1 ; iDim<params.nDim_field ; iDim++ ) {
 #ifndef _NO_MPI_TM
-        #pragma omp for schedule(runtime)
+            #pragma omp for schedule(runtime)
 #else
-        #pragma omp single
+            #pragma omp single
 #endif
-        for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
-            vecPatches( ipatch )->exchNbrOfParticles( smpi, ispec, params, iDim, &vecPatches );
-        }
+            for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+                vecPatches( ipatch )->exchNbrOfParticles( smpi, ispec, params, iDim, &vecPatches );
+            }
 
-        SyncVectorPatch::finalizeExchangeParticles( vecPatches, ispec, iDim, params, smpi );
+            SyncVectorPatch::finalizeExchangeParticles( vecPatches, ispec, iDim, params, smpi );
+        }
     }
 
     #pragma omp for schedule(runtime)
@@ -109,6 +131,48 @@ void SyncVectorPatch::finalizeAndSortParticles( VectorPatch &vecPatches, int isp
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! all_neighbors exchange : send the particles of all species and all local patches to each MPI neighbor
+//! in a single message (the buffers are filled species by species in exchangeParticles)
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::exchangeParticlesAllSpecies( VectorPatch &vecPatches, SmileiMPI * )
+{
+#ifndef _NO_MPI_TM
+    #pragma omp for schedule(runtime)
+#else
+    #pragma omp single
+#endif
+    for( unsigned int irank=0 ; irank<vecPatches.particles_rank_buffers_.size() ; irank++ ) {
+        vecPatches.particles_rank_buffers_.send( vecPatches, irank );
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! all_neighbors exchange : receive the particles of all species, before they are sorted species by species
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::finalizeExchangeParticlesAllSpecies( VectorPatch &vecPatches, SmileiMPI * )
+{
+#ifndef _NO_MPI_TM
+    #pragma omp for schedule(runtime)
+#else
+    #pragma omp single
+#endif
+    for( unsigned int irank=0 ; irank<vecPatches.particles_rank_buffers_.size() ; irank++ ) {
+        vecPatches.particles_rank_buffers_.receive( vecPatches, irank );
+    }
+    
+    // Sends complete only once received by the remote process : wait for them after all receptions
+#ifndef _NO_MPI_TM
+    #pragma omp for schedule(runtime)
+#else
+    #pragma omp single
+#endif
+    for( unsigned int irank=0 ; irank<vecPatches.particles_rank_buffers_.size() ; irank++ ) {
+        vecPatches.particles_rank_buffers_.finalize( vecPatches, irank );
+    }
+}
+
+
 void SyncVectorPatch::finalizeExchangeParticles( VectorPatch &vecPatches, int ispec, int iDim, Params &params, SmileiMPI *smpi )
 {
 #ifndef _NO_MPI_TM
@@ -735,6 +799,34 @@ void SyncVectorPatch::exchangeB( Params &params, VectorPatch &vecPatches, Smilei
     }
 }
 
+// Post the communications of B for the patches which have MPI neighbors
+// The Faraday solver must have been applied on these patches only
+void SyncVectorPatch::initExchangeB( Params &, VectorPatch &vecPatches, SmileiMPI *smpi )
+{
+    // Exchange Bs0 : By_ and Bz_ (dual in X)
+    SyncVectorPatch::initExchangeAllComponentsAlongX( vecPatches, smpi );
+    if( vecPatches.listBx_[0]->dims_.size()>1 ) {
+        // Exchange Bs1 : Bx_ and Bz_ (dual in Y)
+        SyncVectorPatch::initExchangeAllComponentsAlongY( vecPatches, smpi );
+        if( vecPatches.listBx_[0]->dims_.size()>2 ) {
+            // Exchange Bs2 : Bx_ and By_ (dual in Z)
+            SyncVectorPatch::initExchangeAllComponentsAlongZ( vecPatches, smpi );
+        }
+    }
+}
+
+// Copy B between patches of the same MPI process, once the Faraday solver has been applied on all patches
+void SyncVectorPatch::exchangeLocalB( Params &, VectorPatch &vecPatches )
+{
+    SyncVectorPatch::exchangeLocalAllComponentsAlongX( vecPatches.Bs0, vecPatches );
+    if( vecPatches.listBx_[0]->dims_.size()>1 ) {
+        SyncVectorPatch::exchangeLocalAllComponentsAlongY( vecPatches.Bs1, vecPatches );
+        if( vecPatches.listBx_[0]->dims_.size()>2 ) {
+            SyncVectorPatch::exchangeLocalAllComponentsAlongZ( vecPatches.Bs2, vecPatches );
+        }
+    }
+}
+
 void SyncVectorPatch::finalizeexchangeB( Params &params, VectorPatch &vecPatches )
 {
     // full_B_exchange is true if (Buneman BC, Lehe, Bouchard or spectral solvers)
@@ -1086,11 +1178,9 @@ void SyncVectorPatch::exchangeAlongAllDirections( std::vector<Field *> fields, V
                 pt1 = &( *field1 )( size[1]*nz_ );
                 pt2 = &( *field2 )( 0 );
                 for( unsigned int i = 0 ; i < nx_*ny_*nz_ ; i += ny_*nz_ ) {
-                    for( unsigned int j = 0 ; j < oversize[1]*nz_ ; j++ ) {
-                        // Rewrite with memcpy ?
-                        pt2[i+j] = pt1[i+j] ;
-                        pt1[i+j+gsp[1]*nz_] = pt2[i+j+gsp[1]*nz_] ;
-                    }
+                    // The ghost cells of a row are contiguous
+                    memcpy( pt2+i, pt1+i, oversize[1]*nz_*sizeof( T ) );
+                    memcpy( pt1+i+gsp[1]*nz_, pt2+i+gsp[1]*nz_, oversize[1]*nz_*sizeof( T ) );
                 }
             } // End if ( MPI_me_ == MPI_neighbor_[1][0] )
 
@@ -1208,11 +1298,9 @@ void SyncVectorPatch::exchangeAlongAllDirectionsNoOMP( std::vector<Field *> fiel
                 pt1 = &( *field1 )( size[1]*nz_ );
                 pt2 = &( *field2 )( 0 );
                 for( unsigned int i = 0 ; i < nx_*ny_*nz_ ; i += ny_*nz_ ) {
-                    for( unsigned int j = 0 ; j < oversize[1]*nz_ ; j++ ) {
-                        // Rewrite with memcpy ?
-                        pt2[i+j] = pt1[i+j] ;
-                        pt1[i+j+gsp[1]*nz_] = pt2[i+j+gsp[1]*nz_] ;
-                    }
+                    // The ghost cells of a row are contiguous
+                    memcpy( pt2+i, pt1+i, oversize[1]*nz_*sizeof( T ) );
+                    memcpy( pt1+i+gsp[1]*nz_, pt2+i+gsp[1]*nz_, oversize[1]*nz_*sizeof( T ) );
                 }
             } // End if ( MPI_me_ == MPI_neighbor_[1][0] )
 
@@ -1403,11 +1491,9 @@ void SyncVectorPatch::exchangeSynchronizedPerDirection( std::vector<Field *> fie
             for( unsigned int in = 0 ; in < nx_ ; in ++ ) {
                 //for (unsigned int in = oversize[0] ; in < nx_-oversize[0] ; in ++){ // <== This doesn't work. Why ??
                 unsigned int i = in * ny_*nz_;
-                for( unsigned int j = 0 ; j < oversize[1]*nz_ ; j++ ) {
-                    // Rewrite with memcpy ?
-                    pt2[i+j] = pt1[i+j] ;
-                    pt1[i+j+gsp[1]*nz_] = pt2[i+j+gsp[1]*nz_] ;
-                }
+                // The ghost cells of a row are contiguous
+                memcpy( pt2+i, pt1+i, oversize[1]*nz_*sizeof( T ) );
+                memcpy( pt1+i+gsp[1]*nz_, pt2+i+gsp[1]*nz_, oversize[1]*nz_*sizeof( T ) );
             }
         } // End if ( MPI_me_ == MPI_neighbor_[1][0] )
 
@@ -1476,6 +1562,13 @@ void SyncVectorPatch::exchangeSynchronizedPerDirection( std::vector<Field *> fie
 //         - B_Localx : fields which have local neighbor along X (a same field can be adressed by both)
 //     - These fields are identified with lists of index MPIxIdx and LocalxIdx
 void SyncVectorPatch::exchangeAllComponentsAlongX( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi )
+{
+    SyncVectorPatch::initExchangeAllComponentsAlongX( vecPatches, smpi );
+    SyncVectorPatch::exchangeLocalAllComponentsAlongX( fields, vecPatches );
+}
+
+// Initialise the communications of the patches which have an MPI neighbor along X
+void SyncVectorPatch::initExchangeAllComponentsAlongX( VectorPatch &vecPatches, SmileiMPI *smpi )
 {
     unsigned oversize = vecPatches( 0 )->EMfields->oversize[0];
 
@@ -1507,6 +1600,12 @@ void SyncVectorPatch::exchangeAllComponentsAlongX( std::vector<Field *> &fields,
         vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield      ], 0, smpi, true ); // By
         vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield+nMPIx], 0, smpi, true ); // Bz
     }
+}
+
+// Copy the ghost cells between patches owned by the same MPI process along X
+void SyncVectorPatch::exchangeLocalAllComponentsAlongX( std::vector<Field *> &fields, VectorPatch &vecPatches )
+{
+    unsigned oversize = vecPatches( 0 )->EMfields->oversize[0];
 
     unsigned int h0, size;
     double *pt1, *pt2;
@@ -1612,6 +1711,13 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongX( VectorPatch &vecPatch
 //         - B_Localy : fields which have local neighbor along Y (a same field can be adressed by both)
 //     - These fields are identified with lists of index MPIyIdx and LocalyIdx
 void SyncVectorPatch::exchangeAllComponentsAlongY( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi )
+{
+    SyncVectorPatch::initExchangeAllComponentsAlongY( vecPatches, smpi );
+    SyncVectorPatch::exchangeLocalAllComponentsAlongY( fields, vecPatches );
+}
+
+// Initialise the communications of the patches which have an MPI neighbor along Y
+void SyncVectorPatch::initExchangeAllComponentsAlongY( VectorPatch &vecPatches, SmileiMPI *smpi )
 {
     unsigned oversize = vecPatches( 0 )->EMfields->oversize[1];
 
@@ -1643,6 +1749,12 @@ void SyncVectorPatch::exchangeAllComponentsAlongY( std::vector<Field *> &fields,
         vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield      ], 1, smpi, true ); // Bx
         vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1, smpi, true ); // Bz
     }
+}
+
+// Copy the ghost cells between patches owned by the same MPI process along Y
+void SyncVectorPatch::exchangeLocalAllComponentsAlongY( std::vector<Field *> &fields, VectorPatch &vecPatches )
+{
+    unsigned oversize = vecPatches( 0 )->EMfields->oversize[1];
 
     unsigned int h0, size;
     double *pt1, *pt2;
@@ -1743,6 +1855,13 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongY( VectorPatch &vecPatch
 //         - B_Localz : fields which have local neighbor along Z (a same field can be adressed by both)
 //     - These fields are identified with lists of index MPIzIdx and LocalzIdx
 void SyncVectorPatch::exchangeAllComponentsAlongZ( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi )
+{
+    SyncVectorPatch::initExchangeAllComponentsAlongZ( vecPatches, smpi );
+    SyncVectorPatch::exchangeLocalAllComponentsAlongZ( fields, vecPatches );
+}
+
+// Initialise the communications of the patches which have an MPI neighbor along Z
+void SyncVectorPatch::initExchangeAllComponentsAlongZ( VectorPatch &vecPatches, SmileiMPI *smpi )
 {
     unsigned oversize = vecPatches( 0 )->EMfields->oversize[2];
 
@@ -1774,6 +1893,12 @@ void SyncVectorPatch::exchangeAllComponentsAlongZ( std::vector<Field *> fields,
         vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield],       2, smpi, true ); // Bx
         vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2, smpi, true ); // By
     }
+}
+
+// Copy the ghost cells between patches owned by the same MPI process along Z
+void SyncVectorPatch::exchangeLocalAllComponentsAlongZ( std::vector<Field *> fields, VectorPatch &vecPatches )
+{
+    unsigned oversize = vecPatches( 0 )->EMfields->oversize[2];
 
     unsigned int h0, size;
     double *pt1, *pt2;
@@ -20,6 +20,8 @@ public :
     static void exchangeParticles( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi );
     static void finalizeAndSortParticles( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi );
     static void finalizeExchangeParticles( VectorPatch &vecPatches, int ispec, int iDim, Params &params, SmileiMPI *smpi );
+    static void exchangeParticlesAllSpecies( VectorPatch &vecPatches, SmileiMPI *smpi );
+    static void finalizeExchangeParticlesAllSpecies( VectorPatch &vecPatches, SmileiMPI *smpi );
 
     //! Densities synchronization
     static void sumRhoJ( Params &params, VectorPatch &vecPatches, SmileiMPI *smpi );
@@ -378,6 +380,9 @@ public :
     static void finalizeexchangeE( Params &params, VectorPatch &vecPatches );
     static void exchangeB( Params &params, VectorPatch &vecPatches, SmileiMPI *smpi );
     static void finalizeexchangeB( Params &params, VectorPatch &vecPatches );
+    //! exchangeB split in two steps, to overlap communications with the Faraday solver (not with full_B_exchange)
+    static void initExchangeB( Params &params, VectorPatch &vecPatches, SmileiMPI *smpi );
+    static void exchangeLocalB( Params &params, VectorPatch &vecPatches );
     static void exchangeBmBTIS3( Params &params, VectorPatch &vecPatches, int imode, SmileiMPI *smpi );
     static void finalizeexchangeBmBTIS3( Params &params, VectorPatch &vecPatches, int imode );
     static void exchangeBmBTIS3( Params &params, VectorPatch &vecPatches, SmileiMPI *smpi );
@@ -413,10 +418,16 @@ public :
     static void exchangeSynchronizedPerDirection( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi );
 
     static void exchangeAllComponentsAlongX( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi );
+    static void initExchangeAllComponentsAlongX( VectorPatch &vecPatches, SmileiMPI *smpi );
+    static void exchangeLocalAllComponentsAlongX( std::vector<Field *> &fields, VectorPatch &vecPatches );
     static void finalizeExchangeAllComponentsAlongX( VectorPatch &vecPatches );
     static void exchangeAllComponentsAlongY( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi );
+    static void initExchangeAllComponentsAlongY( VectorPatch &vecPatches, SmileiMPI *smpi );
+    static void exchangeLocalAllComponentsAlongY( std::vector<Field *> &fields, VectorPatch &vecPatches );
     static void finalizeExchangeAllComponentsAlongY( VectorPatch &vecPatches );
     static void exchangeAllComponentsAlongZ( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi );
+    static void initExchangeAllComponentsAlongZ( VectorPatch &vecPatches, SmileiMPI *smpi );
+    static void exchangeLocalAllComponentsAlongZ( std::vector<Field *> fields, VectorPatch &vecPatches );
     static void finalizeExchangeAllComponentsAlongZ( VectorPatch &vecPatches );
 
     //! Deprecated field functions
@@ -67,6 +67,8 @@ void VectorPatch::close( SmileiMPI *smpiData )
 
     // Close diagnostics
     closeAllDiags( smpiData );
+    
+    particles_rank_buffers_.close();
 
     if( diag_timers_.size() ) {
         MESSAGE( "\n\tDiagnostics profile :" );
@@ -401,10 +403,13 @@ void VectorPatch::dynamics( Params &params,
     timers.syncPart.restart();
     for( unsigned int ispec=0 ; ispec<( *this )( 0 )->vecSpecies.size(); ispec++ ) {
         Species *spec = species( 0, ispec );
-        if ( (!params.Laser_Envelope_model) && (spec->isProj( time_dual, simWindow )) ){
+        if ( (!params.Laser_Envelope_model) && (spec->isMoving( time_dual )) ){
             SyncVectorPatch::exchangeParticles( ( *this ), ispec, params, smpi ); // Included sortParticles
         } // end condition on Species and on envelope model
     } // end loop on species
+    if( params.all_neighbors_particle_exchange && !params.Laser_Envelope_model ) {
+        SyncVectorPatch::exchangeParticlesAllSpecies( ( *this ), smpi );
+    }
     //MESSAGE("exchange particles");
     timers.syncPart.update( params.printNow( itime ) );
 
@@ -469,8 +474,12 @@ void VectorPatch::finalizeAndSortParticles( Params &params, SmileiMPI *smpi, Sim
     // Particle synchronization and sorting
     // ----------------------------------------
 
+    if( params.all_neighbors_particle_exchange ) {
+        SyncVectorPatch::finalizeExchangeParticlesAllSpecies( ( *this ), smpi );
+    }
+
     for( unsigned int ispec=0 ; ispec<( *this )( 0 )->vecSpecies.size(); ispec++ ) {
-        if( ( *this )( 0 )->vecSpecies[ispec]->isProj( time_dual, simWindow ) ) {
+        if( ( *this )( 0 )->vecSpecies[ispec]->isMoving( time_dual ) ) {
             SyncVectorPatch::finalizeAndSortParticles( ( *this ), ispec, params, smpi ); // Included sortParticles
         }
 
@@ -540,8 +549,8 @@ void VectorPatch::injectParticlesFromBoundaries(Params &params, Timers &timers,
 
     timers.particleInjection.restart();
 
-    //#pragma omp for schedule(runtime)
-    #pragma omp single
+    // Patches are treated in parallel: the profiles are evaluated in critical sections by the ParticleCreator
+    #pragma omp for schedule(runtime)
     for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
 
         Patch * patch = ( *this )( ipatch );
@@ -1035,23 +1044,52 @@ void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime,
         ( *( *this )( ipatch )->EMfields->MaxwellAmpereSolver_ )( ( *this )( ipatch )->EMfields );
     }
 
-    #pragma omp for schedule(static)
-    for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
-        // Computes Bx_, By_, Bz_ at time n+1 on interior points.
-        ( *( *this )( ipatch )->EMfields->MaxwellFaradaySolver_ )( ( *this )( ipatch )->EMfields );
+    // When only some components of B are exchanged, the patches which have MPI neighbors are solved first
+    // and their communications are posted while the Faraday solver runs on the other patches
+    bool overlap_exchange = ( params.geometry != "AMcylindrical" ) && ( !params.full_B_exchange ) && params.exchangeFieldsNow( itime );
+
+    if( overlap_exchange ) {
+        #pragma omp for schedule(static)
+        for( unsigned int i=0 ; i<MPIborderIdx.size() ; i++ ) {
+            unsigned int ipatch = MPIborderIdx[i];
+            ( *( *this )( ipatch )->EMfields->MaxwellFaradaySolver_ )( ( *this )( ipatch )->EMfields );
+        }
+        timers.maxwell.update();
+
+        timers.syncField.restart();
+        SyncVectorPatch::initExchangeB( params, ( *this ), smpi );
+        timers.syncField.update();
+
+        timers.maxwell.restart();
+        #pragma omp for schedule(static)
+        for( unsigned int i=0 ; i<interiorIdx.size() ; i++ ) {
+            unsigned int ipatch = interiorIdx[i];
+            ( *( *this )( ipatch )->EMfields->MaxwellFaradaySolver_ )( ( *this )( ipatch )->EMfields );
+        }
+    } else {
+        #pragma omp for schedule(static)
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            // Computes Bx_, By_, Bz_ at time n+1 on interior points.
+            ( *( *this )( ipatch )->EMfields->MaxwellFaradaySolver_ )( ( *this )( ipatch )->EMfields );
+        }
     }
     //Synchronize B fields between patches.
     timers.maxwell.update( params.printNow( itime ) );
 
 
     timers.syncField.restart();
-    if( params.geometry != "AMcylindrical" ) {
-        if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), smpi );
-        SyncVectorPatch::exchangeB( params, ( *this ), smpi );
-    } else {
-        for( unsigned int imode = 0 ; imode < static_cast<ElectroMagnAM *>( patches_[0]->EMfields )->El_.size() ; imode++ ) {
-            if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), imode, smpi );
-            SyncVectorPatch::exchangeB( params, ( *this ), imode, smpi );
+    // With deep halos, the ghost cells are computed redundantly between two exchanges
+    if( overlap_exchange ) {
+        SyncVectorPatch::exchangeLocalB( params, ( *this ) );
+    } else if( params.exchangeFieldsNow( itime ) ) {
+        if( params.geometry != "AMcylindrical" ) {
+            if( params.is_spectral || params.exchange_fields_each > 1 ) SyncVectorPatch::exchangeE( params, ( *this ), smpi );
+            SyncVectorPatch::exchangeB( params, ( *this ), smpi );
+        } else {
+            for( unsigned int imode = 0 ; imode < static_cast<ElectroMagnAM *>( patches_[0]->EMfields )->El_.size() ; imode++ ) {
+                if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), imode, smpi );
+                SyncVectorPatch::exchangeB( params, ( *this ), imode, smpi );
+            }
         }
     }
     timers.syncField.update( params.printNow( itime ) );
@@ -1163,7 +1201,7 @@ void VectorPatch::finalizeSyncAndBCFields( Params &params, SmileiMPI *smpi, SimW
         double time_dual, Timers &timers, int itime )
 {
     if ( (!params.multiple_decomposition) && ( itime!=0 ) && ( time_dual > params.time_fields_frozen ) ) { // multiple_decomposition = true -> is_spectral = true
-        if( params.geometry != "AMcylindrical" ) {
+        if( params.geometry != "AMcylindrical" && params.exchangeFieldsNow( itime ) ) {
             timers.syncField.restart();
             SyncVectorPatch::finalizeexchangeB( params, ( *this ) );
             timers.syncField.update( params.printNow( itime ) );
@@ -3209,6 +3247,11 @@ void VectorPatch::exchangePatches( SmileiMPI *smpi, Params &params )
     }
     this->setRefHindex() ;
     updateFieldList( smpi ) ;
+    // MPI neighbors changed : persistent requests must be set up again
+    smpi->patch_layout_version++;
+    if( params.all_neighbors_particle_exchange ) {
+        particles_rank_buffers_.build( *this, smpi );
+    }
 
 } // END exchangePatches
 
@@ -3498,6 +3541,21 @@ void VectorPatch::updateFieldList( SmileiMPI *smpi )
         }
     }
 
+    // Patches with at least one MPI neighbor, solved first to overlap the B exchange with the Faraday solver
+    MPIborderIdx.clear();
+    interiorIdx.clear();
+    for( unsigned int ipatch=0 ; ipatch < size() ; ipatch++ ) {
+        bool has_MPI_neighbor = false;
+        for( unsigned int iDim=0 ; iDim < ( unsigned int )nDim ; iDim++ ) {
+            has_MPI_neighbor = has_MPI_neighbor || ( *this )( ipatch )->has_an_MPI_neighbor( iDim );
+        }
+        if( has_MPI_neighbor ) {
+            MPIborderIdx.push_back( ipatch );
+        } else {
+            interiorIdx.push_back( ipatch );
+        }
+    }
+
     B_MPIx.resize( 2*MPIxIdx.size() );
     B_localx.resize( 2*LocalxIdx.size() );
     B1_MPIy.resize( 2*MPIyIdx.size() );
@@ -4587,10 +4645,13 @@ void VectorPatch::ponderomotiveUpdatePositionAndCurrents( Params &params,
 
     timers.syncPart.restart();
     for( unsigned int ispec=0 ; ispec<( *this )( 0 )->vecSpecies.size(); ispec++ ) {
-        if( ( *this )( 0 )->vecSpecies[ispec]->isProj( time_dual, simWindow ) ) {
+        if( ( *this )( 0 )->vecSpecies[ispec]->isMoving( time_dual ) ) {
             SyncVectorPatch::exchangeParticles( ( *this ), ispec, params, smpi ); // Included sortParticles
         } // end condition on species
     } // end loop on species
+    if( params.all_neighbors_particle_exchange ) {
+        SyncVectorPatch::exchangeParticlesAllSpecies( ( *this ), smpi );
+    }
     timers.syncPart.update( params.printNow( itime ) );
 
 
@@ -5061,8 +5122,12 @@ void VectorPatch::dynamicsWithoutTasks( Params &params,
                     }
 #endif
 
+                    // Ballistic photons: no interpolation nor projection
+                    if( spec->isBallisticPhoton( time_dual ) ) {
+                        spec->ballisticPhotonDynamics( params, partwalls( ipatch ), ( *this )( ipatch ), smpi );
+                    }
                     // Dynamics with vectorized operators
-                    if( spec->vectorized_operators ) {
+                    else if( spec->vectorized_operators ) {
                         spec->dynamics( time_dual, ispec,
                                         emfields( ipatch ),
                                         params, diag_flag, partwalls( ipatch ),
@@ -11,6 +11,7 @@
 
 #include "DiagnosticScalar.h"
 
+#include "AsyncMPIbuffers.h"
 #include "Checkpoint.h"
 #include "OpenPMDparams.h"
 #include "SmileiMPI.h"
@@ -347,6 +348,9 @@ public :
     std::vector<int> MPIxIdx;
     std::vector<int> MPIyIdx;
     std::vector<int> MPIzIdx;
+    //! Patches which have at least one MPI neighbor, and the others
+    std::vector<int> MPIborderIdx;
+    std::vector<int> interiorIdx;
     
     std::vector<Field *> B_localx;
     std::vector<Field *> B_MPIx;
@@ -420,6 +424,9 @@ public :
     //! 1st patch index of patches_ (stored for balancing op)
     int refHindex_;
     
+    //! Communication plan of the all_neighbors particle exchange, one message per MPI neighbor
+    ParticlesRankMPIbuffers particles_rank_buffers_;
+    
     //! Count global (MPI x patches) number of particles
     uint64_t getGlobalNumberOfParticles( SmileiMPI *smpi )
     {
@@ -93,6 +93,13 @@ public:
         return profileName_;
     }
 
+    //! Whether the profile may be evaluated by several threads at once (built-in profiles,
+    //! which call neither python nor a file)
+    bool threadSafe()
+    {
+        return ! profileName_.empty() && ! uses_file_;
+    }
+
 private:
     
     //! Name of the profile, in the case of a built-in profile
@@ -114,17 +114,17 @@ void ProjectorAM2OrderV::currentsAndDensity( ElectroMagnAM *emAM,
 
         int np_computed = min( cell_nparts-ivect, vecSize );
         int istart0 = ( int )istart + ivect;
-        complex<double> e_bar[8], e_delta_m1[8];
+        double e_bar_re[8*Nmode_], e_bar_im[8*Nmode_], e_delta_re[8*Nmode_], e_delta_im[8*Nmode_];
 
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            compute_distances( position_x, position_y, position_z, cell_keys, npart_total, ipart, istart0, ipart_ref, deltaold, array_eitheta_old, iold, Sl0_buff_vect, Sr0_buff_vect, DSl, DSr, r_bar, e_bar, e_delta_m1 );
+            compute_distances( position_x, position_y, position_z, cell_keys, npart_total, ipart, istart0, ipart_ref, deltaold, array_eitheta_old, iold, Sl0_buff_vect, Sr0_buff_vect, DSl, DSr, r_bar, e_bar_re, e_bar_im, e_delta_re, e_delta_im );
             charge_weight[ipart] = inv_cell_volume * ( double )( charge[istart0+ipart] )*weight[istart0+ipart];
         }
 
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            computeRho( ipart, charge_weight, DSl, DSr, Sl0_buff_vect, Sr0_buff_vect, brho, invR_local, e_bar);
+            computeRho( ipart, charge_weight, DSl, DSr, Sl0_buff_vect, Sr0_buff_vect, brho, invR_local, e_bar_re, e_bar_im );
         }
     }
 
@@ -506,27 +506,27 @@ void ProjectorAM2OrderV::currents( ElectroMagnAM *emAM,
 
         int np_computed = min( cell_nparts-ivect, vecSize );
         int istart0 = ( int )istart + ivect;
-        complex<double> e_bar[8], e_delta_m1[8];
+        double e_bar_re[8*Nmode_], e_bar_im[8*Nmode_], e_delta_re[8*Nmode_], e_delta_im[8*Nmode_];
 
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            compute_distances( position_x, position_y, position_z, cell_keys, npart_total, ipart, istart0, ipart_ref, deltaold, array_eitheta_old, iold, Sl0_buff_vect, Sr0_buff_vect, DSl, DSr, r_bar, e_bar, e_delta_m1 );
+            compute_distances( position_x, position_y, position_z, cell_keys, npart_total, ipart, istart0, ipart_ref, deltaold, array_eitheta_old, iold, Sl0_buff_vect, Sr0_buff_vect, DSl, DSr, r_bar, e_bar_re, e_bar_im, e_delta_re, e_delta_im );
             charge_weight[ipart] = inv_cell_volume * ( double )( charge[istart0+ipart] )*weight[istart0+ipart];
         }
 
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            computeJl( ipart, charge_weight, DSl, DSr, Sr0_buff_vect, bJl, dl_ov_dt_, invR_local, e_bar);
+            computeJl( ipart, charge_weight, DSl, DSr, Sr0_buff_vect, bJl, dl_ov_dt_, invR_local, e_bar_re, e_bar_im );
         }
 
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            computeJr( ipart, charge_weight, DSl, DSr, Sl0_buff_vect, bJr, one_ov_dt, invRd_local, e_bar, jpom2);
+            computeJr( ipart, charge_weight, DSl, DSr, Sl0_buff_vect, bJr, one_ov_dt, invRd_local, e_bar_re, e_bar_im, jpom2);
         }
 
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            computeJt( ipart, &momentum_y[istart0], &momentum_z[istart0], charge_weight, &invgf[istart0-ipart_ref], DSl, DSr, Sl0_buff_vect, Sr0_buff_vect, bJt, invR_local, r_bar, e_bar, e_delta_m1, one_ov_dt);
+            computeJt( ipart, &momentum_y[istart0], &momentum_z[istart0], charge_weight, &invgf[istart0-ipart_ref], DSl, DSr, Sl0_buff_vect, Sr0_buff_vect, bJt, invR_local, r_bar, e_bar_re, e_bar_im, e_delta_re, e_delta_im, one_ov_dt);
         }
     } //End ivect
 
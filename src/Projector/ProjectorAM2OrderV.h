@@ -56,7 +56,7 @@ private:
                                                                    int npart_total, int ipart, int istart, int ipart_ref,
                                                                    double *deltaold, std::complex<double> *array_eitheta_old, int *iold,
                                                                    double *Sl0, double *Sr0, double *DSl, double *DSr,
-                                                                   double *r_bar, std::complex<double> *e_bar, std::complex<double> *e_delta_m1)
+                                                                   double *r_bar, double *e_bar_re, double *e_bar_im, double *e_delta_re, double *e_delta_im)
     {
 
         int ipo = iold[0];
@@ -119,17 +119,30 @@ private:
 
         r_bar[ipart] = ((jpo + j_domain_begin_ + deltaold[istart+ipart-ipart_ref+npart_total])*dr + rp) * 0.5; // r at t = t0 - dt/2
         std::complex<double> eitheta = ( position_y[istart+ipart] + Icpx * position_z[istart+ipart] ) / rp ; //exp(i theta)
-        e_delta_m1[ipart] = std::sqrt(eitheta * (2.*std::real(array_eitheta_old[istart+ipart-ipart_ref]) - array_eitheta_old[istart+ipart-ipart_ref]));
-        e_bar[ipart] = array_eitheta_old[istart+ipart-ipart_ref] * e_delta_m1[ipart];
+        std::complex<double> e_delta_m1 = std::sqrt( complexProduct( eitheta, std::conj( array_eitheta_old[istart+ipart-ipart_ref] ) ) );
+        std::complex<double> e_bar_m1 = complexProduct( array_eitheta_old[istart+ipart-ipart_ref], e_delta_m1 );
+
+        // Powers 1 to Nmode_ of e_bar and e_delta, shared by all the projection kernels: e_bar^m is stored at (m-1)*vecSize+ipart
+        e_bar_re  [ipart] = std::real( e_bar_m1 );
+        e_bar_im  [ipart] = std::imag( e_bar_m1 );
+        e_delta_re[ipart] = std::real( e_delta_m1 );
+        e_delta_im[ipart] = std::imag( e_delta_m1 );
+        for( unsigned int imode=1; imode<Nmode_; imode++ ) {
+            int i0 = ( imode-1 )*vecSize+ipart;
+            e_bar_re  [i0+vecSize] = e_bar_re  [i0]*std::real( e_bar_m1 )   - e_bar_im  [i0]*std::imag( e_bar_m1 );
+            e_bar_im  [i0+vecSize] = e_bar_re  [i0]*std::imag( e_bar_m1 )   + e_bar_im  [i0]*std::real( e_bar_m1 );
+            e_delta_re[i0+vecSize] = e_delta_re[i0]*std::real( e_delta_m1 ) - e_delta_im[i0]*std::imag( e_delta_m1 );
+            e_delta_im[i0+vecSize] = e_delta_re[i0]*std::imag( e_delta_m1 ) + e_delta_im[i0]*std::real( e_delta_m1 );
+        }
 
     }
 
-    inline void __attribute__((always_inline)) computeJl( int ipart, double *charge_weight, double *DSl, double *DSr, double *Sr0, std::complex<double> *bJ, double, double *invR_local, std::complex<double> *e_bar )
+    inline void __attribute__((always_inline)) computeJl( int ipart, double *charge_weight, double *DSl, double *DSr, double *Sr0, std::complex<double> *bJ, double, double *invR_local, double *e_bar_re, double *e_bar_im )
     {
 
         int vecSize = 8;
         double sum[5];
-        std::complex<double> C_m =2.;
+        std::complex<double> C_m;
         double crl_p = charge_weight[ipart]*dl_ov_dt_;
         
         sum[0] = 0.;
@@ -154,7 +167,7 @@ private:
         }
         //mode > 0
         for (unsigned int imode=1; imode<Nmode_; imode++){ 
-            C_m *= e_bar[ipart];
+            C_m = std::complex<double>( 2.*e_bar_re[( imode-1 )*vecSize+ipart], 2.*e_bar_im[( imode-1 )*vecSize+ipart] );
             tmp = crl_p * ( 0.5*DSr[ipart] ) * invR_local[0] ;
             UNROLL_S(4)
             for( unsigned int i=1 ; i<5 ; i++ ) {
@@ -171,12 +184,12 @@ private:
         }
     }
 
-    inline void __attribute__((always_inline)) computeJr( int ipart, double *charge_weight, double *DSl, double *DSr, double *Sl0, std::complex<double> *bJ, double one_ov_dt, double *invRd_local, std::complex<double> *e_bar, int jpo )
+    inline void __attribute__((always_inline)) computeJr( int ipart, double *charge_weight, double *DSl, double *DSr, double *Sl0, std::complex<double> *bJ, double one_ov_dt, double *invRd_local, double *e_bar_re, double *e_bar_im, int jpo )
     {
 
         int vecSize = 8;
         double sum[5];
-        std::complex<double> C_m =2.;
+        std::complex<double> C_m;
         double crr_p = charge_weight[ipart]*one_ov_dt;
         
         sum[4] = 0.;
@@ -202,7 +215,7 @@ private:
 
         //mode > 0
         for (unsigned int imode=1; imode<Nmode_; imode++){ 
-            C_m *= e_bar[ipart];
+            C_m = std::complex<double>( 2.*e_bar_re[( imode-1 )*vecSize+ipart], 2.*e_bar_im[( imode-1 )*vecSize+ipart] );
             tmp = 0.5*DSl[ipart];
             UNROLL_S(4)
             for( unsigned int j=0 ; j<4 ; j++ ) {
@@ -225,7 +238,8 @@ private:
                                                                    double *charge_weight,
                                                                    double *invgf,
                                                                    double *DSl, double *DSr, double *Sl0_buff_vect, double *Sr0_buff_vect,
-                                                                   std::complex<double> *bJ, double *invR_local, double *r_bar, std::complex<double> *e_bar_m1, std::complex<double> *e_delta_m1, 
+                                                                   std::complex<double> *bJ, double *invR_local, double *r_bar,
+                                                                   double *e_bar_re, double *e_bar_im, double *e_delta_re, double *e_delta_im,
                                                                    double one_ov_dt)
     {
 
@@ -253,27 +267,30 @@ private:
         Sr0_buff_vect[2*vecSize + ipart] *= invR_local[3];
 
         //mode 0
-        std::complex<double> crt_p= charge_weight[ipart]*( momentum_z[ipart]* real(e_bar_m1[ipart]) - momentum_y[ipart]*imag(e_bar_m1[ipart]) ) * invgf[ipart];
+        std::complex<double> crt_p= charge_weight[ipart]*( momentum_z[ipart]* e_bar_re[ipart] - momentum_y[ipart]*e_bar_im[ipart] ) * invgf[ipart];
         std::complex<double> e_delta = 0.5;
-        std::complex<double> e_bar = 1.;
 
 
         for (unsigned int imode=0; imode<Nmode_; imode++){ 
             if (imode > 0){
-                e_delta *= e_delta_m1[ipart];
-                e_bar *= e_bar_m1[ipart];
-                crt_p = charge_weight[ipart]*Icpx*e_bar * one_ov_dt * 2. * r_bar[ipart] /( double )imode ;
+                int im = ( imode-1 )*vecSize+ipart;
+                e_delta = std::complex<double>( e_delta_re[im], e_delta_im[im] );
+                // i*e_bar
+                crt_p = std::complex<double>( -e_bar_im[im], e_bar_re[im] ) * ( charge_weight[ipart] * one_ov_dt * 2. * r_bar[ipart] /( double )imode );
             }
+            // Coefficients of S1 and S0 in the charge conservation equation
+            std::complex<double> crt_p1 = complexProduct( crt_p, e_delta-1. );
+            std::complex<double> crt_p0 = complexProduct( crt_p, std::conj(e_delta)-1. );
 
             //j=0 case
             UNROLL_S(5)
             for( unsigned int i=0 ; i<5 ; i++ ) {
-                bJ [200*imode + (i*5 )*vecSize + ipart] -= crt_p*(Sr1[0]*Sl1[i]*( e_delta-1. ) );
+                bJ [200*imode + (i*5 )*vecSize + ipart] -= crt_p1*(Sr1[0]*Sl1[i]);
             }
             //i=0 case
             UNROLL_S(4)
             for( unsigned int j=1 ; j<5 ; j++ ) {
-                bJ [200*imode + (j)*vecSize + ipart] -= crt_p*(Sr1[j]*Sl1[0]*( e_delta-1. ) );
+                bJ [200*imode + (j)*vecSize + ipart] -= crt_p1*(Sr1[j]*Sl1[0]);
             }
 
 
@@ -281,18 +298,17 @@ private:
             for( unsigned int i=1 ; i<5 ; i++ ) {
                 UNROLL_S(4)
                 for ( unsigned int j=1; j<5 ; j++ ) {
-                    bJ [200*imode + (i*5+j )*vecSize + ipart] -= crt_p*(Sr1[j]*Sl1[i]*( e_delta-1. ) - Sr0_buff_vect[(j-1)*vecSize + ipart]*Sl0_buff_vect[(i-1)*vecSize + ipart]*(std::conj(e_delta) - 1.));
+                    bJ [200*imode + (i*5+j )*vecSize + ipart] -= crt_p1*(Sr1[j]*Sl1[i]) - crt_p0*(Sr0_buff_vect[(j-1)*vecSize + ipart]*Sl0_buff_vect[(i-1)*vecSize + ipart]);
                 }
             }
 
-            if (imode == 0) e_delta = 1. ; //Restore e_delta correct initial value.
        }
     }
 
     inline void __attribute__((always_inline)) computeRho( int ipart, 
                                                                    double *charge_weight,
                                                                    double *DSl, double *DSr, double *Sl0_buff_vect, double *Sr0_buff_vect,
-                                                                   std::complex<double> *brho, double *invR_local, std::complex<double> *e_bar_m1) 
+                                                                   std::complex<double> *brho, double *invR_local, double *e_bar_re, double *e_bar_im ) 
     {
 
         int vecSize = 8;
@@ -320,12 +336,10 @@ private:
 
         //mode 0
         std::complex<double> C_m = 1.;
-        std::complex<double> e_bar = 1.;
 
         for (unsigned int imode=0; imode<Nmode_; imode++){ 
             if (imode > 0){
-                e_bar *= e_bar_m1[ipart];
-                C_m = 2. * e_bar;
+                C_m = std::complex<double>( 2.*e_bar_re[( imode-1 )*vecSize+ipart], 2.*e_bar_im[( imode-1 )*vecSize+ipart] );
             }
 
             UNROLL_S(5)
@@ -75,11 +75,11 @@ void PusherPhoton::operator()( Particles &particles, SmileiMPI *smpi,
                                        momentum_z[ipart]*momentum_z[ipart] );
 
         // Move the photons
-        position_x[ipart] += dt*momentum_x[ipart]*invgf[ipart];
+        position_x[ipart] += dt*momentum_x[ipart]*invgf[ipart - ipart_ref];
         if (nDim_>1) {
-            position_y[ipart] += dt*momentum_y[ipart]*invgf[ipart];
+            position_y[ipart] += dt*momentum_y[ipart]*invgf[ipart - ipart_ref];
             if (nDim_>2) {
-                position_z[ipart] += dt*momentum_z[ipart]*invgf[ipart];
+                position_z[ipart] += dt*momentum_z[ipart]*invgf[ipart - ipart_ref];
             }
         }
 
@@ -31,6 +31,21 @@ def _prepare_checkpoint_dir():
         else:
             _mkdir("checkpoint", checkpoint_dir)
 
+def _restart_dir_pattern():
+    pattern = Checkpoints.restart_dir + os.sep + "checkpoints" + os.sep
+    if Checkpoints.file_grouping:
+        pattern += "*"+ os.sep
+    pattern += "dump-*-*.h5"
+    return pattern
+
+# List of the checkpoint files in restart_dir, one per line, made by the master only
+# and broadcast to all processes before _smilei_check
+_restart_dir_listing = ""
+def _list_restart_dir():
+    global _restart_dir_listing
+    if len(Checkpoints)==1 and Checkpoints.restart_dir and len(Checkpoints.restart_files) == 0:
+        _restart_dir_listing = "\n".join(glob(_restart_dir_pattern()))
+
 def _smilei_check():
     """Do checks over the script"""
     
@@ -52,12 +67,13 @@ def _smilei_check():
     if len(Checkpoints)==1 and Checkpoints.restart_dir:
         if len(Checkpoints.restart_files) == 0 :
             Checkpoints.restart = True
-            pattern = Checkpoints.restart_dir + os.sep + "checkpoints" + os.sep
-            if Checkpoints.file_grouping:
-                pattern += "*"+ os.sep
-            pattern += "dump-*-*.h5"
+            pattern = _restart_dir_pattern()
             # pick those file that match the mpi rank
-            files = filter(lambda a: smilei_mpi_rank==int(search(r'dump-[0-9]*-([0-9]*).h5$',a).groups()[-1]), glob(pattern))
+            all_files = [f for f in _restart_dir_listing.split("\n") if f]
+            files = list(filter(lambda a: smilei_mpi_rank==int(search(r'dump-[0-9]*-([0-9]*).h5$',a).groups()[-1]), all_files))
+            # processes beyond those of the previous run start from the files of rank 0
+            if len(files) == 0:
+                files = filter(lambda a: 0==int(search(r'dump-[0-9]*-([0-9]*).h5$',a).groups()[-1]), all_files)
             
             if Checkpoints.restart_number is not None:
                 # pick those file that match the restart_number
@@ -171,6 +171,10 @@ class Main(SmileiSingleton):
     patch_arrangement = "hilbertian"
     cluster_width = -1
     every_clean_particles_overhead = 100
+    exchange_fields_each = 1
+    particle_exchange = "per_direction"
+    persistent_field_communications = False
+    diagnostics_io_aggregation = "none"
     timestep = None
     number_of_AM = 2
     number_of_AM_relativistic_field_initialization = 1
@@ -522,6 +526,7 @@ class DiagParticleBinning(SmileiComponent):
     axes = []
     every = None
     flush_every = 1
+    sparse = False
 
 class DiagRadiationSpectrum(SmileiComponent):
     """Radiation Spectrum diagnostic"""
@@ -560,6 +565,9 @@ class DiagFields(SmileiComponent):
     fields = []
     time_average = 1
     subgrid = None
+    coarsening = 1
+    compression = 0
+    compression_digits = None
     flush_every = 1
     datatype = "double"
 
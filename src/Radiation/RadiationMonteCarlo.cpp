@@ -617,12 +617,9 @@ void RadiationMonteCarlo::operator()(
 
     //if (photons) std::cerr << photons->deviceSize()  << std::endl;
 
-    // Remove extra space to save memory
-#ifndef SMILEI_OPENACC_MODE
-    if (photons) {
-        photons->shrinkToFit( true );
-    }
-#endif
+    // The capacity of the photon buffer is kept for the next iterations
+    // so that the reservation above does not reallocate at every time step.
+    // It is released in Patch::cleanParticlesOverhead.
 
     // Update the patch radiated energy
     radiated_energy += radiated_energy_loc;
@@ -195,19 +195,23 @@ int main( int argc, char *argv[] )
     // Init and compute tables for radiation effects
     // (nonlinear inverse Compton scattering)
     // ---------------------------------------------------------------------
+    timers.initTables.restart();
     radiation_tables_.initialization( params, &smpi);
 
     // ---------------------------------------------------------------------
     // Init and compute tables for multiphoton Breit-Wheeler pair creation
     // ---------------------------------------------------------------------
     multiphoton_Breit_Wheeler_tables_.initialization( params, &smpi );
+    timers.initTables.update();
 
     // reading from dumped file the restart values
     if( params.restart ) {
         // smpi.patch_count recomputed in readPatchDistribution
+        timers.initRestart.restart();
         checkpoint.readPatchDistribution( &smpi, simWindow );
+        timers.initRestart.update();
         // allocate patches according to smpi.patch_count
-        PatchesFactory::createVector( vecPatches, params, &smpi, openPMD, &radiation_tables_, checkpoint.this_run_start_step+1, simWindow->getNmoved() );
+        PatchesFactory::createVector( vecPatches, params, &smpi, openPMD, &radiation_tables_, checkpoint.this_run_start_step+1, simWindow->getNmoved(), &timers );
 
         // allocate region according to dump
         if( params.multiple_decomposition ) {
@@ -246,11 +250,15 @@ int main( int argc, char *argv[] )
         //     region.identify_missing_patches( &smpi, vecPatches, params );
         // }
 
+        timers.initRestart.restart();
         checkpoint.restartAll( vecPatches, region, &smpi, params );
+        timers.initRestart.update();
 
 #if !defined( SMILEI_ACCELERATOR_MODE )
         // CPU only, its too early to sort on GPU
+        timers.initSorting.restart();
         vecPatches.initialParticleSorting( params );
+        timers.initSorting.update();
 #endif
 
         TITLE( "Minimum memory consumption (does not include all temporary buffers)" );
@@ -269,11 +277,13 @@ int main( int argc, char *argv[] )
     // No restart, we initialize a new simulation
     } else {
 
-        PatchesFactory::createVector( vecPatches, params, &smpi, openPMD, &radiation_tables_, 0 );
+        PatchesFactory::createVector( vecPatches, params, &smpi, openPMD, &radiation_tables_, 0, 0, &timers );
 
 #if !(defined( SMILEI_ACCELERATOR_MODE ))
         // CPU only, its too early to sort on GPU
+        timers.initSorting.restart();
         vecPatches.initialParticleSorting( params );
+        timers.initSorting.update();
 #endif
 
         // Initialize the electromagnetic fields
@@ -306,6 +316,7 @@ int main( int argc, char *argv[] )
         vecPatches.checkMemoryConsumption( &smpi, &region.vecPatch_ );
 
         TITLE( "Initial fields setup" );
+        timers.initFields.restart();
 
         // Solve "Relativistic Poisson" problem (including proper centering of fields)
         // NOTE: the mean gamma for initialization will be computed for all the species
@@ -405,6 +416,7 @@ int main( int argc, char *argv[] )
                 }
             }
         }
+        timers.initFields.update();
     }
 
 #if defined( SMILEI_ACCELERATOR_MODE )
@@ -419,6 +431,7 @@ int main( int argc, char *argv[] )
 #endif
 
     TITLE( "Open files & initialize diagnostics" );
+    timers.initDiags.restart();
     vecPatches.initAllDiags( params, &smpi );
 
     if( !params.restart ) {
@@ -430,10 +443,14 @@ int main( int argc, char *argv[] )
 #endif
         
     }
+    timers.initDiags.update();
 
     TITLE( "Species creation summary" );
     vecPatches.printGlobalNumberOfParticlesPerSpecies( &smpi );
 
+    TITLE( "Initialization profile (seconds per MPI process)" );
+    timers.profileInitialization( &smpi );
+
     if( params.is_pxr ){
         if( params.multiple_decomposition ) {
             region.coupling( params, false );
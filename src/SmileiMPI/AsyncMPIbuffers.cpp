@@ -2,17 +2,28 @@
 #include "AsyncMPIbuffers.h"
 #include "Field.h"
 #include "Patch.h"
+#include "Species.h"
+#include "VectorPatch.h"
 
+#include <algorithm>
+#include <cstring>
+#include <map>
 #include <vector>
 using namespace std;
 
 AsyncMPIbuffers::AsyncMPIbuffers()
 {
+    persistent_version_ = 0;
 }
 
 
 AsyncMPIbuffers::~AsyncMPIbuffers()
 {
+    int finalized( 0 );
+    MPI_Finalized( &finalized );
+    if( persistent_version_ && !finalized ) {
+        freePersistentRequests();
+    }
 }
 
 
@@ -21,8 +32,8 @@ void AsyncMPIbuffers::allocate( unsigned int ndims )
     srequest.resize( ndims );
     rrequest.resize( ndims );
     for( unsigned int i=0 ; i<ndims ; i++ ) {
-        srequest[i].resize( 2 );
-        rrequest[i].resize( 2 );
+        srequest[i].resize( 2, MPI_REQUEST_NULL );
+        rrequest[i].resize( 2, MPI_REQUEST_NULL );
     }
     
     send_tags_.resize( ndims );
@@ -59,6 +70,22 @@ void AsyncMPIbuffers::defineTags( Patch *patch, SmileiMPI *smpi, int tag )
 }
 
 
+void AsyncMPIbuffers::freePersistentRequests()
+{
+    for( unsigned int iDim=0 ; iDim<srequest.size() ; iDim++ ) {
+        for( unsigned int iNeighbor=0 ; iNeighbor<srequest[iDim].size() ; iNeighbor++ ) {
+            if( srequest[iDim][iNeighbor] != MPI_REQUEST_NULL ) {
+                MPI_Request_free( &( srequest[iDim][iNeighbor] ) );
+            }
+            if( rrequest[iDim][iNeighbor] != MPI_REQUEST_NULL ) {
+                MPI_Request_free( &( rrequest[iDim][iNeighbor] ) );
+            }
+        }
+    }
+    persistent_version_ = 0;
+}
+
+
 SpeciesMPIbuffers::SpeciesMPIbuffers()
 {
 }
@@ -93,3 +120,204 @@ void SpeciesMPIbuffers::allocate( unsigned int ndims )
     
 }
 
+
+void SpeciesMPIbuffers::allocateAllNeighbors( unsigned int ndims )
+{
+    unsigned int nnbr = 1;
+    for( unsigned int i=0 ; i<ndims ; i++ ) {
+        nnbr *= 3;
+    }
+    
+    partSendNbr.resize( nnbr );
+    partRecvNbr.resize( nnbr );
+    part_index_send_nbr.resize( nnbr );
+    
+}
+
+
+ParticlesRankMPIbuffers::ParticlesRankMPIbuffers()
+{
+    comm_ = MPI_COMM_NULL;
+}
+
+
+ParticlesRankMPIbuffers::~ParticlesRankMPIbuffers()
+{
+}
+
+
+void ParticlesRankMPIbuffers::build( VectorPatch &vecPatches, SmileiMPI *smpi )
+{
+    if( comm_ == MPI_COMM_NULL ) {
+        MPI_Comm_dup( smpi->world(), &comm_ );
+    }
+    
+    ranks_.clear();
+    send_list_.clear();
+    recv_list_.clear();
+    
+    // Receive entries are sorted as the sender sorts them : by hindex of the sending patch, then by direction
+    std::map< int, unsigned int > rank_index;
+    std::vector< std::vector< std::pair< std::pair<int, int>, std::pair<unsigned int, int> > > > recv_keys;
+    
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        Patch *patch = vecPatches( ipatch );
+        int nnbr = patch->all_neighbor_.size();
+        for( int iNbr=0 ; iNbr<nnbr ; iNbr++ ) {
+            if( ( patch->all_neighbor_[iNbr]==MPI_PROC_NULL ) || ( patch->all_MPI_neighbor_[iNbr]==patch->MPI_me_ ) ) {
+                continue;
+            }
+            int rank = patch->all_MPI_neighbor_[iNbr];
+            std::map< int, unsigned int >::iterator it = rank_index.find( rank );
+            unsigned int irank;
+            if( it == rank_index.end() ) {
+                irank = ranks_.size();
+                rank_index[rank] = irank;
+                ranks_.push_back( rank );
+                send_list_.resize( irank+1 );
+                recv_keys.resize( irank+1 );
+            } else {
+                irank = it->second;
+            }
+            // Patches are stored by increasing hindex : sends are already sorted
+            send_list_[irank].push_back( std::make_pair( ipatch, iNbr ) );
+            recv_keys[irank].push_back( std::make_pair( std::make_pair( patch->all_neighbor_[iNbr], nnbr-1-iNbr ), std::make_pair( ipatch, iNbr ) ) );
+        }
+    }
+    
+    recv_list_.resize( ranks_.size() );
+    for( unsigned int irank=0 ; irank<ranks_.size() ; irank++ ) {
+        std::sort( recv_keys[irank].begin(), recv_keys[irank].end() );
+        for( unsigned int i=0 ; i<recv_keys[irank].size() ; i++ ) {
+            recv_list_[irank].push_back( recv_keys[irank][i].second );
+        }
+    }
+    
+    send_count_.resize( ranks_.size() );
+    srequest_.assign( ranks_.size(), MPI_REQUEST_NULL );
+    send_type_.assign( ranks_.size(), MPI_DATATYPE_NULL );
+}
+
+
+void ParticlesRankMPIbuffers::send( VectorPatch &vecPatches, unsigned int irank )
+{
+    unsigned int nspec = vecPatches( 0 )->vecSpecies.size();
+    
+    std::vector< std::pair<unsigned int, int> > &entries = send_list_[irank];
+    
+    // A single message per MPI process :
+    //   - header : the number of particles of each species, for each (patch, direction) of send_list_
+    //   - then the properties of these particles, in the same order, as in SmileiMPI::createMPIparticles
+    std::vector<int> &count = send_count_[irank];
+    count.resize( entries.size()*nspec );
+    std::vector<int> block_length( 1, count.size() );
+    std::vector<MPI_Aint> address( 1 );
+    std::vector<MPI_Datatype> block_type( 1, MPI_INT );
+    MPI_Get_address( &( count[0] ), &( address[0] ) );
+    for( unsigned int ientry=0 ; ientry<entries.size() ; ientry++ ) {
+        Patch *patch = vecPatches( entries[ientry].first );
+        int iNbr = entries[ientry].second;
+        for( unsigned int ispec=0 ; ispec<nspec ; ispec++ ) {
+            Particles &part = patch->vecSpecies[ispec]->MPI_buffer_.partSendNbr[iNbr];
+            int n = part.size();
+            count[ientry*nspec+ispec] = n;
+            if( n == 0 ) {
+                continue;
+            }
+            for( unsigned int iprop=0 ; iprop<part.double_prop_.size() ; iprop++ ) {
+                address.push_back( 0 );
+                MPI_Get_address( &( ( *( part.double_prop_[iprop] ) )[0] ), &( address.back() ) );
+                block_length.push_back( n );
+                block_type.push_back( MPI_DOUBLE );
+            }
+            for( unsigned int iprop=0 ; iprop<part.short_prop_.size() ; iprop++ ) {
+                address.push_back( 0 );
+                MPI_Get_address( &( ( *( part.short_prop_[iprop] ) )[0] ), &( address.back() ) );
+                block_length.push_back( n );
+                block_type.push_back( MPI_SHORT );
+            }
+            for( unsigned int iprop=0 ; iprop<part.uint64_prop_.size() ; iprop++ ) {
+                address.push_back( 0 );
+                MPI_Get_address( &( ( *( part.uint64_prop_[iprop] ) )[0] ), &( address.back() ) );
+                block_length.push_back( n );
+                block_type.push_back( MPI_UNSIGNED_LONG_LONG );
+            }
+        }
+    }
+    MPI_Type_create_struct( block_length.size(), &( block_length[0] ), &( address[0] ), &( block_type[0] ), &( send_type_[irank] ) );
+    MPI_Type_commit( &( send_type_[irank] ) );
+    
+    MPI_Isend( MPI_BOTTOM, 1, send_type_[irank], ranks_[irank], 0, comm_, &( srequest_[irank] ) );
+}
+
+
+void ParticlesRankMPIbuffers::receive( VectorPatch &vecPatches, unsigned int irank )
+{
+    unsigned int nspec = vecPatches( 0 )->vecSpecies.size();
+    
+    std::vector< std::pair<unsigned int, int> > &entries = recv_list_[irank];
+    
+    // The size of the message is known only once it is probed
+    MPI_Message message;
+    MPI_Status rstat;
+    MPI_Mprobe( ranks_[irank], 0, comm_, &message, &rstat );
+    int message_size( 0 );
+    MPI_Get_count( &rstat, MPI_BYTE, &message_size );
+    std::vector<char> message_buffer( message_size );
+    MPI_Mrecv( &( message_buffer[0] ), message_size, MPI_BYTE, &message, &rstat );
+    
+    // Unpack the particles of each (patch, direction) and each species in its receive buffer
+    std::vector<int> count( entries.size()*nspec );
+    memcpy( &( count[0] ), &( message_buffer[0] ), count.size()*sizeof( int ) );
+    size_t offset = count.size()*sizeof( int );
+    for( unsigned int ientry=0 ; ientry<entries.size() ; ientry++ ) {
+        Patch *patch = vecPatches( entries[ientry].first );
+        int iNbr = entries[ientry].second;
+        for( unsigned int ispec=0 ; ispec<nspec ; ispec++ ) {
+            int n = count[ientry*nspec+ispec];
+            if( n == 0 ) {
+                continue;
+            }
+            Particles &part = patch->vecSpecies[ispec]->MPI_buffer_.partRecvNbr[iNbr];
+            part.initialize( n, *patch->vecSpecies[ispec]->particles_to_move );
+            for( unsigned int iprop=0 ; iprop<part.double_prop_.size() ; iprop++ ) {
+                memcpy( &( ( *( part.double_prop_[iprop] ) )[0] ), &( message_buffer[offset] ), n*sizeof( double ) );
+                offset += n*sizeof( double );
+            }
+            for( unsigned int iprop=0 ; iprop<part.short_prop_.size() ; iprop++ ) {
+                memcpy( &( ( *( part.short_prop_[iprop] ) )[0] ), &( message_buffer[offset] ), n*sizeof( short ) );
+                offset += n*sizeof( short );
+            }
+            for( unsigned int iprop=0 ; iprop<part.uint64_prop_.size() ; iprop++ ) {
+                memcpy( &( ( *( part.uint64_prop_[iprop] ) )[0] ), &( message_buffer[offset] ), n*sizeof( uint64_t ) );
+                offset += n*sizeof( uint64_t );
+            }
+        }
+    }
+}
+
+
+void ParticlesRankMPIbuffers::finalize( VectorPatch &vecPatches, unsigned int irank )
+{
+    unsigned int nspec = vecPatches( 0 )->vecSpecies.size();
+    
+    MPI_Status sstat;
+    MPI_Wait( &( srequest_[irank] ), &sstat );
+    MPI_Type_free( &( send_type_[irank] ) );
+    // Species which are not exchanged at the next step must send no particle
+    std::vector< std::pair<unsigned int, int> > &sent = send_list_[irank];
+    for( unsigned int ientry=0 ; ientry<sent.size() ; ientry++ ) {
+        for( unsigned int ispec=0 ; ispec<nspec ; ispec++ ) {
+            vecPatches( sent[ientry].first )->vecSpecies[ispec]->MPI_buffer_.partSendNbr[sent[ientry].second].clear();
+        }
+    }
+}
+
+
+void ParticlesRankMPIbuffers::close()
+{
+    if( comm_ != MPI_COMM_NULL ) {
+        MPI_Comm_free( &comm_ );
+    }
+}
+
@@ -10,6 +10,7 @@
 class Field;
 class Patch;
 class SmileiMPI;
+class VectorPatch;
 
 class AsyncMPIbuffers
 {
@@ -21,6 +22,13 @@ public:
     
     void defineTags( Patch *patch, SmileiMPI *smpi, int tag ) ;
     
+    //! Free the persistent requests stored in srequest and rrequest
+    void freePersistentRequests();
+    
+    //! Version of the patch layout (SmileiMPI::patch_layout_version) for which
+    //!   srequest and rrequest are persistent requests, 0 if they are not
+    unsigned int persistent_version_;
+    
     //! ndim vectors of 2 sent requests (1 per direction)
     std::vector< std::vector<MPI_Request> > srequest;
     //! ndim vectors of 2 received requests (1 per direction)
@@ -39,6 +47,8 @@ public:
     ~SpeciesMPIbuffers();
     
     void allocate( unsigned int nDim_field ) ;
+    //! Allocate the buffers of the all_neighbors exchange (3^nDim_field, the central one is unused)
+    void allocateAllNeighbors( unsigned int nDim_field ) ;
     
     //! ndim vectors of 2 sent packets of particles (1 per direction)
     std::vector< std::vector<Particles > > partRecv;
@@ -54,6 +64,57 @@ public:
     //! ndim vectors of 2 numbers of particles to receive (1 per direction)
     std::vector< std::vector< unsigned int > > part_index_recv_sz;
     
+    //! 3^ndim packets of particles sent to all the neighbors, corners included (all_neighbors exchange)
+    std::vector<Particles> partSendNbr;
+    //! 3^ndim packets of particles received from all the neighbors, corners included (all_neighbors exchange)
+    std::vector<Particles> partRecvNbr;
+    //! 3^ndim vectors of index particles to send to all the neighbors (all_neighbors exchange)
+    std::vector< std::vector<int> > part_index_send_nbr;
+    
+};
+
+//! Communication plan of the all_neighbors particle exchange, gathered per MPI process :
+//!   all the particles sent by the local patches to the patches of a same MPI process travel in a single message
+class ParticlesRankMPIbuffers
+{
+public:
+    ParticlesRankMPIbuffers();
+    ~ParticlesRankMPIbuffers();
+    
+    //! Build the plan from the neighborhood of the local patches, to call after patches moved (load balancing)
+    void build( VectorPatch &vecPatches, SmileiMPI *smpi );
+    //! Send the message to the MPI process irank of the plan, for all local patches and all species
+    void send( VectorPatch &vecPatches, unsigned int irank );
+    //! Receive the message of the MPI process irank, unpacked in the partRecvNbr buffers
+    void receive( VectorPatch &vecPatches, unsigned int irank );
+    //! Finalize the send to the MPI process irank, to call once all messages are received
+    void finalize( VectorPatch &vecPatches, unsigned int irank );
+    //! Release the communicator
+    void close();
+    
+    //! Number of MPI processes in the plan
+    inline unsigned int size()
+    {
+        return ranks_.size();
+    }
+    
+private:
+    //! Communicator dedicated to these messages, no tag is shared with the patch level communications
+    MPI_Comm comm_;
+    
+    //! MPI processes owning a neighbor of a local patch
+    std::vector<int> ranks_;
+    //! Per MPI process, the (local patch, neighbor direction) packed in the sent message,
+    //!   sorted by sender patch then direction
+    std::vector< std::vector< std::pair<unsigned int, int> > > send_list_;
+    //! Per MPI process, the (local patch, neighbor direction) unpacked from the received message,
+    //!   in the order of the sent message of the remote process
+    std::vector< std::vector< std::pair<unsigned int, int> > > recv_list_;
+    
+    //! Per MPI process, the number of particles of each species for each entry of send_list_ (message header)
+    std::vector< std::vector<int> > send_count_;
+    std::vector<MPI_Request> srequest_;
+    std::vector<MPI_Datatype> send_type_;
 };
 
 #endif
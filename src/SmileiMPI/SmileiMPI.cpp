@@ -49,6 +49,8 @@ using namespace std;
 SmileiMPI::SmileiMPI( int *argc, char ***argv )
 {
     test_mode = false;
+    persistent_field_requests = false;
+    patch_layout_version = 1;
 
     // Send information on current simulation
     int mpi_provided;
@@ -86,6 +88,10 @@ SmileiMPI::~SmileiMPI()
 {
     delete[]periods_;
 
+    if( diagnostics_io_info_ != MPI_INFO_NULL ) {
+        MPI_Info_free( &diagnostics_io_info_ );
+    }
+
     MPI_Finalize();
 
 } // END SmileiMPI::~SmileiMPI
@@ -150,6 +156,32 @@ void SmileiMPI::init( Params &params, DomainDecomposition *domain_decomposition
     int n_envlaser = PyTools::nComponents( "LaserEnvelope" );
     
     use_BTIS3 = params.use_BTIS3;
+    
+    persistent_field_requests = params.persistent_field_communications;
+
+    // MPI-IO hints so that only a few aggregator processes access the diagnostics files
+    if( params.diagnostics_io_aggregation != 0 ) {
+        int n_aggregators;
+        MPI_Info_create( &diagnostics_io_info_ );
+        if( params.diagnostics_io_aggregation < 0 ) {
+            // One aggregator per node: count the nodes with shared-memory communicators
+            MPI_Comm node_comm;
+            MPI_Comm_split_type( world_, MPI_COMM_TYPE_SHARED, smilei_rk, MPI_INFO_NULL, &node_comm );
+            int node_rank;
+            MPI_Comm_rank( node_comm, &node_rank );
+            int node_leader = ( node_rank == 0 ) ? 1 : 0;
+            MPI_Allreduce( &node_leader, &n_aggregators, 1, MPI_INT, MPI_SUM, world_ );
+            MPI_Comm_free( &node_comm );
+            MPI_Info_set( diagnostics_io_info_, "cb_config_list", "*:1" );
+        } else {
+            n_aggregators = ( smilei_sz - 1 ) / params.diagnostics_io_aggregation + 1;
+            MPI_Info_set( diagnostics_io_info_, "cb_config_list", "*:*" );
+        }
+        MPI_Info_set( diagnostics_io_info_, "cb_nodes", to_string( n_aggregators ).c_str() );
+        MPI_Info_set( diagnostics_io_info_, "romio_cb_write", "enable" );
+        MPI_Info_set( diagnostics_io_info_, "romio_cb_read", "enable" );
+        MESSAGE( 1, "Diagnostics are written by " << n_aggregators << " I/O aggregators" );
+    }
 
 #ifdef _OPENMP
     dynamics_Epart.resize( omp_get_max_threads() );
@@ -2431,7 +2463,11 @@ void SmileiMPI::computeGlobalDiags( DiagnosticScalar *scalars, int itime )
 void SmileiMPI::computeGlobalDiags( DiagnosticParticleBinning *diagParticles, int itime )
 {
     if( itime - diagParticles->timeSelection->previousTime() == diagParticles->time_average-1 ) {
-        MPI_Reduce( diagParticles->filename.size()?MPI_IN_PLACE:&diagParticles->data_sum[0], &diagParticles->data_sum[0], diagParticles->output_size, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+        if( diagParticles->sparse_ ) {
+            reduceSparseHistogram( diagParticles->sparse_index_, diagParticles->sparse_data_ );
+        } else {
+            MPI_Reduce( diagParticles->filename.size()?MPI_IN_PLACE:&diagParticles->data_sum[0], &diagParticles->data_sum[0], diagParticles->output_size, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+        }
 
         if( !isMaster() ) {
             diagParticles->clear();
@@ -2468,6 +2504,41 @@ void SmileiMPI::computeGlobalDiags(DiagnosticRadiationSpectrum* diagRad, int iti
 } // END computeGlobalDiags(DiagnosticRadiationSpectrum*  ...)
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Binomial tree reduction of a sparse histogram: at each stage, half of the remaining
+// processes send their list of non-empty bins to a partner which merges it into its own
+// ---------------------------------------------------------------------------------------------------------------------
+void SmileiMPI::reduceSparseHistogram( std::vector<int> &index, std::vector<double> &data )
+{
+    for( int step = 1; step < smilei_sz; step *= 2 ) {
+        if( smilei_rk % ( 2*step ) != 0 ) {
+            // Send to the partner and leave the reduction
+            int n = index.size();
+            int to = smilei_rk - step;
+            MPI_Send( &n, 1, MPI_INT, to, 0, world_ );
+            if( n > 0 ) {
+                MPI_Send( &index[0], n, MPI_INT, to, 1, world_ );
+                MPI_Send( &data[0], n, MPI_DOUBLE, to, 2, world_ );
+            }
+            break;
+        } else if( smilei_rk + step < smilei_sz ) {
+            // Receive from the partner and merge
+            int n;
+            int from = smilei_rk + step;
+            MPI_Status status;
+            MPI_Recv( &n, 1, MPI_INT, from, 0, world_, &status );
+            if( n > 0 ) {
+                vector<int> recv_index( n );
+                vector<double> recv_data( n );
+                MPI_Recv( &recv_index[0], n, MPI_INT, from, 1, world_, &status );
+                MPI_Recv( &recv_data[0], n, MPI_DOUBLE, from, 2, world_, &status );
+                Histogram::mergeSparse( index, data, recv_index, recv_data );
+            }
+        }
+    }
+} // END reduceSparseHistogram
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Buffer management
 // ---------------------------------------------------------------------------------------------------------------------
@@ -148,6 +148,8 @@ public:
     void computeGlobalDiags(DiagnosticScreen*            diag, int timestep);
     // MPI synchronization of radiation spectrum diags
     void computeGlobalDiags(DiagnosticRadiationSpectrum* diag, int timestep);
+    // Tree reduction, towards the master, of a sparse histogram sorted by index
+    void reduceSparseHistogram( std::vector<int> &index, std::vector<double> &data );
 
     // MPI basic methods
     // -----------------
@@ -179,6 +181,12 @@ public:
         return world_;
     }
 
+    //! Return the MPI-IO hints of the diagnostics files (MPI_INFO_NULL if no aggregation)
+    inline MPI_Info diagnosticsIOInfo()
+    {
+        return diagnostics_io_info_;
+    }
+
     //! Return omp_max_threads
     inline int getOMPMaxThreads()
     {
@@ -403,6 +411,15 @@ public:
 #endif
 
     bool use_BTIS3;
+    
+    //! Field exchanges and sums use persistent requests (MPI_Send_init/MPI_Recv_init)
+    bool persistent_field_requests;
+    //! Incremented each time patches move (load balancing, moving window) :
+    //!   persistent requests set up for a previous version are rebuilt
+    unsigned int patch_layout_version;
+    
+    //! MPI-IO hints gathering the writes of the diagnostics on a few aggregator processes
+    MPI_Info diagnostics_io_info_ = MPI_INFO_NULL;
 
 protected:
     //! Global MPI Communicator
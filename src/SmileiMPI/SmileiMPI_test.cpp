@@ -34,6 +34,8 @@ int get_integer_argument( int *argc, char ***argv )
 SmileiMPI_test::SmileiMPI_test( int *argc, char ***argv )
 {
     test_mode = true;
+    persistent_field_requests = false;
+    patch_layout_version = 1;
 
     // If first argument is a number, interpret as the number of MPIs
     int nMPI = get_integer_argument( argc, argv );
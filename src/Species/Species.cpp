@@ -385,6 +385,13 @@ void Species::initOperators( Params &params, Patch *patch )
             MPI_buffer_.part_index_send_sz[iDim][iNeighbor] = 0;
         }
     }
+    if( params.all_neighbors_particle_exchange ) {
+        MPI_buffer_.allocateAllNeighbors( nDim_field );
+        for( unsigned int iNbr=0 ; iNbr < MPI_buffer_.partRecvNbr.size() ; iNbr++ ) {
+            MPI_buffer_.partRecvNbr[iNbr].initialize( 0, ( *particles ) );
+            MPI_buffer_.partSendNbr[iNbr].initialize( 0, ( *particles ) );
+        }
+    }
     typePartSend.resize( nDim_field*2, MPI_DATATYPE_NULL );
     typePartRecv.resize( nDim_field*2, MPI_DATATYPE_NULL );
     exchangePatch = MPI_DATATYPE_NULL;
@@ -1006,6 +1013,67 @@ void Species::dynamics( double time_dual,
     } // End projection for frozen particles
 } //END dynamics
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Photons which do not decay into pairs only need their momentum to move:
+//! the fields are neither interpolated nor projected
+// ---------------------------------------------------------------------------------------------------------------------
+bool Species::isBallisticPhoton( double time_dual ) const
+{
+#if defined( SMILEI_ACCELERATOR_MODE )
+    return false;
+#else
+    return mass_ == 0
+           && time_dual > time_frozen_
+           && !Multiphoton_Breit_Wheeler_process
+           && !particles->interpolated_fields_;
+#endif
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Push, walls, boundary conditions and cell keys of ballistic photons, bin by bin
+//! so that the particles of a bin are still in cache for every step.
+//! Only the buffer of the inverse Lorentz factor is needed (for the walls and boundary conditions).
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::ballisticPhotonDynamics( Params &params, PartWalls *partWalls, Patch *patch, SmileiMPI *smpi )
+{
+    const int ithread = Tools::getOMPThreadNum();
+
+    smpi->dynamics_invgf[ithread].resize( particles->size() );
+
+    // Reinitialize count for sorting
+    for( unsigned int i=0; i<count.size(); i++ ) {
+        count[i] = 0;
+    }
+
+    double nrj_lost = 0.;
+    for( unsigned int ibin = 0 ; ibin < particles->numberOfBins() ; ibin++ ) {
+        const int istart = particles->first_index[ibin];
+        const int iend   = particles->last_index[ibin];
+        if( iend <= istart ) {
+            continue;
+        }
+
+        patch->startFineTimer(1);
+        ( *Push )( *particles, smpi, istart, iend, ithread );
+        patch->stopFineTimer(1);
+
+        patch->startFineTimer(3);
+        double energy_lost = 0.;
+        for( unsigned int iwall=0; iwall<partWalls->size(); iwall++ ) {
+            ( *partWalls )[iwall]->apply( this, istart, iend, smpi->dynamics_invgf[ithread], patch->rand_, energy_lost );
+            nrj_lost += energy_lost;
+        }
+        partBoundCond->apply( this, istart, iend, smpi->dynamics_invgf[ithread], patch->rand_, energy_lost );
+        nrj_lost += energy_lost;
+
+        // Cell keys of the remaining photons (vectorized species only)
+        computeParticleCellKeys( params, particles, particles->getPtrCellKeys(), count.data(), istart, iend );
+        patch->stopFineTimer(3);
+    }
+
+    nrj_bc_lost += nrj_lost;
+}
+
 #ifdef _OMPTASKS
 void Species::dynamicsTasks( double time_dual, unsigned int ispec,
                         ElectroMagn *EMfields,
@@ -1921,11 +1989,7 @@ void Species::sortParticles( Params &params )
     }
     //Make room for new particles
     if( shift[particles->last_index.size()] ) {
-        //! vecor::resize of Charge crashed ! Temporay solution : push_back / Particle
-        //particles->initialize( particles->size()+shift[particles->last_index.size()], particles->Position.size() );
-        for( int inewpart=0 ; inewpart<shift[particles->last_index.size()] ; inewpart++ ) {
-            particles->createParticle();
-        }
+        particles->createParticles( shift[particles->last_index.size()] );
     }
 
     //Shift bins, must be done sequentially
@@ -2146,66 +2210,60 @@ void Species::importParticles( Params &params, Patch *patch, Particles &source_p
         birth_records_->update( source_particles, npart, time_dual, I );
     }
     
-    // Move particles
-    vector<int> src_bin_keys( npart, 0 );
-    for( unsigned int i=0; i<npart; i++ ) {
-        // Copy particle to the correct bin
-        src_bin_keys[i] = source_particles.position( 0, i )*inv_cell_length - ( patch->getCellStartingGlobalIndex( 0 ) + params.oversize[0] );
-        src_bin_keys[i] /= params.cluster_width_;
-    }
-
-    vector<int> bin_count( nbin, 0 );
-    for( unsigned int ip=0; ip < npart ; ip++ )
-        bin_count[src_bin_keys[ip]] ++;
-
-    // sort new parts par bins
-    int istart = 0;
-    int istop  = bin_count[0];
-
-    for ( int ibin = 0 ; ibin < (int)nbin ; ibin++ ) {
-        if (bin_count[ibin]!=0) {
-            for( int ip=istart; ip < istop ; ip++ ) {
-                if ( src_bin_keys[ip] == ibin )
-                    continue;
-                else { // rearrange particles
-                    int ip_swap = istop;
-                    while (( src_bin_keys[ip_swap] != ibin ) && (ip_swap<(int)npart))
-                        ip_swap++;
-                    source_particles.swapParticle(ip, ip_swap);
-                    int tmp = src_bin_keys[ip];
-                    src_bin_keys[ip] = src_bin_keys[ip_swap];
-                    src_bin_keys[ip_swap] = tmp;
-                } // rearrange particles
-            } // end loop on particles of a cell
-
-            // inject in main data structure per cell
-            source_particles.copyParticles( istart, bin_count[ibin],
-                                        *particles,
-                                        particles->first_index[ibin] );
-            particles->last_index[ibin] += bin_count[ibin];
-            for ( unsigned int idx=ibin+1 ; idx<particles->last_index.size() ; idx++ ) {
-                particles->first_index[idx] += bin_count[ibin];
-                particles->last_index[idx]  += bin_count[ibin];
-            }
+    if( npart == 0 ) {
+        return;
+    }
+
+    // Bin of a new particle (same convention as the bin sorting)
+    const double bin_offset = patch->getCellStartingGlobalIndex( 0 ) + params.oversize[0];
+    auto binKey = [&]( unsigned int ip ) {
+        int key = source_particles.position( 0, ip )*inv_cell_length - bin_offset;
+        return key / ( int )params.cluster_width_;
+    };
+
+    // First pass: count the new particles per bin
+    vector<unsigned int> bin_count( nbin, 0 );
+    for( unsigned int ip=0; ip < npart ; ip++ ) {
+        bin_count[binKey( ip )] ++;
+    }
 
+    // Reserve the room of all new particles at once
+    const unsigned int old_size = particles->size();
+    particles->resize( old_size + npart );
+
+    // Shift the existing bins (and any particle beyond the last bin) to open
+    // a contiguous slot at the beginning of each bin, starting from the end
+    // so that no particle is overwritten before being moved
+    unsigned int shift = npart;
+    for( unsigned int ip = old_size; ip > ( unsigned int )particles->last_index[nbin-1]; ip-- ) {
+        particles->overwriteParticle( ip-1, ip-1+shift );
+    }
+    for( int ibin = nbin-1 ; ibin >= 0 && shift > 0 ; ibin-- ) {
+        const unsigned int first = particles->first_index[ibin];
+        const unsigned int last  = particles->last_index[ibin];
+        for( unsigned int ip = last; ip > first; ip-- ) {
+            particles->overwriteParticle( ip-1, ip-1+shift );
         }
-        // update istart/istop fot the next cell
-        istart += bin_count[ibin];
-        if ( ibin != (int)nbin-1  )
-            istop  += bin_count[ibin+1];
-        else
-            istop = npart;
-
-    } // End cell loop
-    //particles->cell_keys.resize( particles->size() );
+        shift -= bin_count[ibin];
+        particles->first_index[ibin] += shift;
+        particles->last_index[ibin]  += shift + bin_count[ibin];
+    }
+
+    // Second pass: copy each new particle directly into its slot
+    // (bin_count becomes the next free slot of each bin)
+    for( unsigned int ibin = 0 ; ibin < nbin ; ibin++ ) {
+        bin_count[ibin] = particles->first_index[ibin];
+    }
+    for( unsigned int ip=0; ip < npart ; ip++ ) {
+        source_particles.overwriteParticle( ip, *particles, bin_count[binKey( ip )]++ );
+    }
+
     particles->resizeCellKeys( particles->size() );
 
-    // Clear all particles
+    // Clear all particles, but keep the capacity of the buffer for the next
+    // iterations (released in Patch::cleanParticlesOverhead)
     source_particles.clear();
 
-    // Put capacity to 0 to save memory
-    source_particles.shrinkToFit(true);
-
 #endif
 
 }
@@ -2762,6 +2820,11 @@ bool Species::isProj( double time_dual, SimWindow *simWindow )
     //return time_dual > species_param.time_frozen_  || (simWindow && simWindow->isMoving(time_dual)) ;
 }
 
+bool Species::isMoving( double time_dual ) const
+{
+    return time_dual > time_frozen_;
+}
+
 void Species::disableXmax()
 {
     partBoundCond->bc_xmax   = &internal_sup;
@@ -2774,9 +2837,124 @@ void Species::setXminBoundaryCondition()
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Particle merging cell by cell
+// Particles of the scalar species are only sorted per bin: they are grouped per cell
+// in scratch index arrays so that each cell is merged independently, without moving particles.
 // ---------------------------------------------------------------------------------------------------------------------
-void Species::mergeParticles( double /*time_dual*/ )
+void Species::mergeParticles( double time_dual )
 {
+    // Only for moving particles
+    if( time_dual>time_frozen_ ) {
+
+        MergingBuffers & buffers = Merging::threadBuffers();
+
+        const unsigned int npart = particles->last_index.back();
+        const unsigned int nbin = particles->first_index.size();
+
+        // Number of cells (same keys as the species sorted per cell)
+        unsigned int ncell = nbin*cluster_width_ + 1;
+        for( unsigned int idim = 1 ; idim < nDim_field ; idim++ ) {
+            ncell *= length_[idim];
+        }
+
+        int * __restrict__ cell_keys = MergingBuffers::reserve( buffers.cell_keys, npart );
+        unsigned int * __restrict__ cell_count = MergingBuffers::reserve( buffers.cell_count, ncell+1 );
+        unsigned int * __restrict__ sorted = MergingBuffers::reserve( buffers.cell_sorted_particles, npart );
+
+        // Mask of the removed particles, reused from one call to another
+        std::vector <int> &mask = buffers.mask;
+        MergingBuffers::reserve( mask, npart );
+        std::fill( mask.begin(), mask.begin() + npart, 1 );
+
+        // Cell key of each particle
+        const double *const __restrict__ position_x = particles->getPtrPosition( 0 );
+        const double min_loc_x = std::round( min_loc_vec[0] * dx_inv_[0] );
+        for( unsigned int ibin = 0 ; ibin < nbin ; ibin++ ) {
+            const unsigned int istart = particles->first_index[ibin];
+            const unsigned int iend = particles->last_index[ibin];
+            if( geometry == "AMcylindrical" ) {
+                const double *const __restrict__ position_y = particles->getPtrPosition( 1 );
+                const double *const __restrict__ position_z = particles->getPtrPosition( 2 );
+                const double min_loc_r = std::round( min_loc_vec[1] * dx_inv_[1] );
+                #pragma omp simd
+                for( unsigned int ip = istart ; ip < iend ; ip++ ) {
+                    cell_keys[ip]  = std::round( position_x[ip] * dx_inv_[0] ) - min_loc_x;
+                    cell_keys[ip] *= length_[1];
+                    cell_keys[ip] += std::round( std::sqrt( position_y[ip]*position_y[ip] + position_z[ip]*position_z[ip] ) * dx_inv_[1] ) - min_loc_r;
+                }
+            } else if( nDim_field == 3 ) {
+                const double *const __restrict__ position_y = particles->getPtrPosition( 1 );
+                const double *const __restrict__ position_z = particles->getPtrPosition( 2 );
+                const double min_loc_y = std::round( min_loc_vec[1] * dx_inv_[1] );
+                const double min_loc_z = std::round( min_loc_vec[2] * dx_inv_[2] );
+                #pragma omp simd
+                for( unsigned int ip = istart ; ip < iend ; ip++ ) {
+                    cell_keys[ip]  = std::round( position_x[ip] * dx_inv_[0] ) - min_loc_x;
+                    cell_keys[ip] *= length_[1];
+                    cell_keys[ip] += std::round( position_y[ip] * dx_inv_[1] ) - min_loc_y;
+                    cell_keys[ip] *= length_[2];
+                    cell_keys[ip] += std::round( position_z[ip] * dx_inv_[2] ) - min_loc_z;
+                }
+            } else if( nDim_field == 2 ) {
+                const double *const __restrict__ position_y = particles->getPtrPosition( 1 );
+                const double min_loc_y = std::round( min_loc_vec[1] * dx_inv_[1] );
+                #pragma omp simd
+                for( unsigned int ip = istart ; ip < iend ; ip++ ) {
+                    cell_keys[ip]  = std::round( position_x[ip] * dx_inv_[0] ) - min_loc_x;
+                    cell_keys[ip] *= length_[1];
+                    cell_keys[ip] += std::round( position_y[ip] * dx_inv_[1] ) - min_loc_y;
+                }
+            } else {
+                #pragma omp simd
+                for( unsigned int ip = istart ; ip < iend ; ip++ ) {
+                    cell_keys[ip]  = std::round( position_x[ip] * dx_inv_[0] ) - min_loc_x;
+                }
+            }
+        }
+
+        // Counting sort of the particle indexes per cell:
+        // cell_count[ic] ends up being the end of cell ic in `sorted`
+        std::fill( cell_count, cell_count + ncell + 1, 0 );
+        for( unsigned int ibin = 0 ; ibin < nbin ; ibin++ ) {
+            for( int ip = particles->first_index[ibin] ; ip < particles->last_index[ibin] ; ip++ ) {
+                cell_count[cell_keys[ip]+1]++;
+            }
+        }
+        for( unsigned int ic = 1 ; ic <= ncell ; ic++ ) {
+            cell_count[ic] += cell_count[ic-1];
+        }
+        for( unsigned int ibin = 0 ; ibin < nbin ; ibin++ ) {
+            for( int ip = particles->first_index[ibin] ; ip < particles->last_index[ibin] ; ip++ ) {
+                sorted[cell_count[cell_keys[ip]]++] = ip;
+            }
+        }
+
+        // For each cell, we apply independently the merging process
+        int remaining = npart;
+        unsigned int cell_start = 0;
+        for( unsigned int ic = 0 ; ic < ncell ; ic++ ) {
+            const unsigned int cell_end = cell_count[ic];
+            Merge->merge( mass_, *particles, mask, &sorted[cell_start], cell_end - cell_start, remaining );
+            cell_start = cell_end;
+        }
+
+        // We remove empty space bin by bin and update the bin indexes
+        unsigned int idest = 0;
+        for( unsigned int ibin = 0 ; ibin < nbin ; ibin++ ) {
+            const unsigned int istart = particles->first_index[ibin];
+            const unsigned int iend = particles->last_index[ibin];
+            particles->first_index[ibin] = idest;
+            for( unsigned int ip = istart ; ip < iend ; ip++ ) {
+                if( mask[ip] >= 0 ) {
+                    if( ip != idest ) {
+                        particles->overwriteParticle( ip, idest );
+                    }
+                    idest++;
+                }
+            }
+            particles->last_index[ibin] = idest;
+        }
+        particles->resize( idest );
+    }
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
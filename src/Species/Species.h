@@ -422,6 +422,14 @@ public:
                            RadiationTables &RadiationTables,
                            MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables );
 
+    //! True if the species is made of photons which only need a straight-line push
+    //! at this time step (no pair decay, no interpolated fields to keep)
+    bool isBallisticPhoton( double time_dual ) const;
+
+    //! Dynamics of ballistic photons: push, walls, boundary conditions and cell keys
+    //! are applied bin by bin, without field interpolation, projection nor field buffers
+    void ballisticPhotonDynamics( Params &params, PartWalls *partWalls, Patch *patch, SmileiMPI *smpi );
+
     //! Method projecting susceptibility and calculating the particles updated momentum (interpolation, momentum pusher), only particles interacting with envelope
     virtual void ponderomotiveUpdateSusceptibilityAndMomentum( double time_dual,
             ElectroMagn *EMfields,
@@ -523,6 +531,10 @@ public:
     //! Method to know if we have to project this species or not.
     bool  isProj( double time_dual, SimWindow *simWindow );
 
+    //! Method to know if the particles of this species move at this time step.
+    //! Frozen particles never leave their patch nor their bin: they need neither exchange nor sorting.
+    bool  isMoving( double time_dual ) const;
+
     inline double computeEnergy()
     {
         double nrj( 0. );
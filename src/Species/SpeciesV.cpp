@@ -1747,7 +1747,11 @@ void SpeciesV::mergeParticles( double time_dual )
         // double weight_after = 0;
         // double energy_before = 0;
         // double energy_after = 0;
-        std::vector <int> mask(particles->last_index.back(), 1);
+        // Mask of the removed particles, reused from one call to another
+        std::vector <int> &mask = Merging::threadBuffers().mask;
+        const unsigned int npart = particles->last_index.back();
+        MergingBuffers::reserve( mask, npart );
+        std::fill( mask.begin(), mask.begin() + npart, 1 );
 
         // Resize the cell_keys
         // particles->cell_keys.resize( particles->last_index.back(), 1 );
@@ -0,0 +1,129 @@
+#include "FFT.h"
+
+#include <cmath>
+
+#include "dcomplex.h"
+
+using namespace std;
+
+FFT::FFT( unsigned int n ) :
+    n_( n )
+{
+    twiddles_.resize( n_ );
+    for( unsigned int k=0; k<n_; k++ ) {
+        double phase = -2.*M_PI*( double )k/( double )n_;
+        twiddles_[k] = complex<double>( cos( phase ), sin( phase ) );
+    }
+
+    // Radices 4 first, then 2, then odd primes
+    unsigned int m = n_;
+    unsigned int p = 4;
+    while( m > 1 ) {
+        while( m % p ) {
+            switch( p ) {
+                case 4: p = 2; break;
+                case 2: p = 3; break;
+                default: p += 2; break;
+            }
+            if( p*p > m ) {
+                p = m;
+            }
+        }
+        m /= p;
+        radix_.push_back( p );
+        remaining_.push_back( m );
+    }
+}
+
+void FFT::transform( const complex<double> *in, unsigned int stride, complex<double> *out, int sign ) const
+{
+    if( n_ == 1 ) {
+        out[0] = in[0];
+        return;
+    }
+    work( out, in, stride, 1, 0, sign );
+}
+
+void FFT::work( complex<double> *out, const complex<double> *in, unsigned int in_stride, unsigned int fstride, unsigned int ifactor, int sign ) const
+{
+    const unsigned int p = radix_[ifactor];
+    const unsigned int m = remaining_[ifactor];
+
+    if( m == 1 ) {
+        for( unsigned int j=0; j<p; j++ ) {
+            out[j] = in[j*fstride*in_stride];
+        }
+    } else {
+        // p interleaved sub-transforms of length m
+        for( unsigned int j=0; j<p; j++ ) {
+            work( out + j*m, in + j*fstride*in_stride, in_stride, fstride*p, ifactor+1, sign );
+        }
+    }
+
+    switch( p ) {
+        case 2: butterfly2( out, fstride, m, sign ); break;
+        case 4: butterfly4( out, fstride, m, sign ); break;
+        default: butterflyGeneric( out, fstride, p, m, sign ); break;
+    }
+}
+
+void FFT::butterfly2( complex<double> *out, unsigned int fstride, unsigned int m, int sign ) const
+{
+    for( unsigned int k=0; k<m; k++ ) {
+        complex<double> tw = sign < 0 ? twiddles_[k*fstride] : conj( twiddles_[k*fstride] );
+        complex<double> t = complexProduct( out[m+k], tw );
+        out[m+k] = out[k] - t;
+        out[k] += t;
+    }
+}
+
+void FFT::butterfly4( complex<double> *out, unsigned int fstride, unsigned int m, int sign ) const
+{
+    for( unsigned int k=0; k<m; k++ ) {
+        complex<double> tw1 = twiddles_[  k*fstride];
+        complex<double> tw2 = twiddles_[2*k*fstride];
+        complex<double> tw3 = twiddles_[3*k*fstride];
+        if( sign > 0 ) {
+            tw1 = conj( tw1 );
+            tw2 = conj( tw2 );
+            tw3 = conj( tw3 );
+        }
+        complex<double> s0 = complexProduct( out[  m+k], tw1 );
+        complex<double> s1 = complexProduct( out[2*m+k], tw2 );
+        complex<double> s2 = complexProduct( out[3*m+k], tw3 );
+        complex<double> s5 = out[k] - s1;
+        out[k] += s1;
+        complex<double> s3 = s0 + s2;
+        complex<double> s4 = s0 - s2;
+        out[2*m+k] = out[k] - s3;
+        out[k] += s3;
+        // -i*s4 for the forward transform, +i*s4 for the backward transform
+        complex<double> is4 = sign < 0 ? complex<double>( s4.imag(), -s4.real() ) : complex<double>( -s4.imag(), s4.real() );
+        out[  m+k] = s5 + is4;
+        out[3*m+k] = s5 - is4;
+    }
+}
+
+void FFT::butterflyGeneric( complex<double> *out, unsigned int fstride, unsigned int p, unsigned int m, int sign ) const
+{
+    vector<complex<double>> scratch( p );
+    for( unsigned int u=0; u<m; u++ ) {
+        for( unsigned int q=0; q<p; q++ ) {
+            scratch[q] = out[u+q*m];
+        }
+        for( unsigned int q1=0; q1<p; q1++ ) {
+            unsigned int k = u+q1*m;
+            unsigned int twidx = 0;
+            complex<double> sum = scratch[0];
+            for( unsigned int q=1; q<p; q++ ) {
+                twidx += fstride*k;
+                if( twidx >= n_ ) {
+                    twidx -= n_;
+                }
+                complex<double> tw = sign < 0 ? twiddles_[twidx] : conj( twiddles_[twidx] );
+                sum += complexProduct( scratch[q], tw );
+            }
+            out[k] = sum;
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef FFT_H
+#define FFT_H
+
+#include <complex>
+#include <vector>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class FFT: one-dimensional complex discrete Fourier transform of a fixed length
+//! Mixed-radix Cooley-Tukey algorithm, so that any length is accepted (lengths with small prime factors are faster).
+//! The backward transform is not normalized.
+//  --------------------------------------------------------------------------------------------------------------------
+class FFT
+{
+public:
+    FFT( unsigned int n );
+    ~FFT() {};
+
+    //! Transforms the n values of `in` (separated by `stride`) into the n contiguous values of `out`
+    //! sign = -1 for the forward transform, +1 for the backward transform
+    void transform( const std::complex<double> *in, unsigned int stride, std::complex<double> *out, int sign ) const;
+
+    unsigned int size() const
+    {
+        return n_;
+    }
+
+private:
+    //! Recursive step of the transform for the radices starting at ifactor
+    void work( std::complex<double> *out, const std::complex<double> *in, unsigned int in_stride, unsigned int fstride, unsigned int ifactor, int sign ) const;
+
+    //! Butterflies combining p sub-transforms of length m
+    void butterfly2( std::complex<double> *out, unsigned int fstride, unsigned int m, int sign ) const;
+    void butterfly4( std::complex<double> *out, unsigned int fstride, unsigned int m, int sign ) const;
+    void butterflyGeneric( std::complex<double> *out, unsigned int fstride, unsigned int p, unsigned int m, int sign ) const;
+
+    //! Transform length
+    unsigned int n_;
+
+    //! Radices p and the corresponding remaining lengths m, in the order of the recursion
+    std::vector<unsigned int> radix_, remaining_;
+
+    //! exp( -2 i pi k / n ) for k < n
+    std::vector<std::complex<double>> twiddles_;
+};
+
+#endif
@@ -2,12 +2,12 @@
 #include <iomanip>
 
 //! Open HDF5 file + location
-H5::H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise )
+H5::H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise, MPI_Info info )
 {
-    init( file, access, comm, _raise );
+    init( file, access, comm, _raise, info );
 }
 
-void H5::init( std::string file, unsigned access, MPI_Comm * comm, bool _raise )
+void H5::init( std::string file, unsigned access, MPI_Comm * comm, bool _raise, MPI_Info info )
 {
     
     // Analyse file string : separate file name and tree inside hdf5 file
@@ -39,7 +39,13 @@ void H5::init( std::string file, unsigned access, MPI_Comm * comm, bool _raise )
     // Open or create
     hid_t fapl = H5Pcreate( H5P_FILE_ACCESS );
     if( comm ) {
-        H5Pset_fapl_mpio( fapl, *comm, MPI_INFO_NULL );
+        H5Pset_fapl_mpio( fapl, *comm, info );
+        // With I/O aggregation, metadata is also written collectively instead of by each process
+#if H5_VERSION_GE( 1, 10, 0 )
+        if( info != MPI_INFO_NULL ) {
+            H5Pset_coll_metadata_write( fapl, true );
+        }
+#endif
     }
     if( access == H5F_ACC_RDWR ) {
         fid_ = H5Fcreate( filepath_.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl );
@@ -117,6 +123,8 @@ H5Space::H5Space( hsize_t size ) {
         H5Sselect_none( sid_ );
     }
     chunk_.resize(0);
+    deflate_ = 0;
+    scaleoffset_ = -1;
 }
 
 //! 1D
@@ -136,6 +144,8 @@ H5Space::H5Space( hsize_t size, hsize_t offset, hsize_t npoints, hsize_t chunk,
     } else {
         chunk_.resize( 0 );
     }
+    deflate_ = 0;
+    scaleoffset_ = -1;
 }
 
 //! ND
@@ -167,4 +177,6 @@ H5Space::H5Space( std::vector<hsize_t> size, std::vector<hsize_t> offset, std::v
         }
     }
     chunk_ = chunk;
+    deflate_ = 0;
+    scaleoffset_ = -1;
 }
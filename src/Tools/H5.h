@@ -2,6 +2,7 @@
 #define H5_H
 
 #include <hdf5.h>
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -57,6 +58,11 @@ public:
     std::vector<hsize_t> chunk_;
     hsize_t global_;
     
+    //! Deflate level of chunked datasets (0 = no compression)
+    int deflate_;
+    //! Decimal digits kept by the scale-offset filter of chunked datasets (negative = no filter)
+    int scaleoffset_;
+    
 };
 
 class H5
@@ -70,12 +76,12 @@ public:
         dcr_ = -1;
     };
     
-    //! Open HDF5 file + location
-    H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise );
+    //! Open HDF5 file + location (info = MPI-IO hints of a parallel file)
+    H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise, MPI_Info info = MPI_INFO_NULL );
     
     ~H5();
     
-    void init( std::string file, unsigned access, MPI_Comm * comm, bool _raise );
+    void init( std::string file, unsigned access, MPI_Comm * comm, bool _raise, MPI_Info info = MPI_INFO_NULL );
     
     bool valid() {
         return id_ >= 0;
@@ -129,8 +135,8 @@ class H5Write : public H5
 {
 public:
     //! Open HDF5 file + location
-    H5Write( std::string file, MPI_Comm * comm = NULL, bool _raise = true )
-     : H5( file, H5F_ACC_RDWR, comm, _raise ) {};
+    H5Write( std::string file, MPI_Comm * comm = NULL, bool _raise = true, MPI_Info info = MPI_INFO_NULL )
+     : H5( file, H5F_ACC_RDWR, comm, _raise, info ) {};
     
     //! Create group inside the given H5Write location
     H5Write( H5Write *loc, std::string group_name )
@@ -141,8 +147,19 @@ public:
      : H5( -1, loc->dcr_, loc->dxpl_ )
     {
         H5D_layout_t layout = H5Pget_layout( dcr_ );
+        bool filtered = false;
         if( ! filespace->chunk_.empty() ) {
             H5Pset_chunk( dcr_, filespace->chunk_.size(), &filespace->chunk_[0] );
+            // The scale-offset filter must come first in the pipeline
+            if( filespace->scaleoffset_ >= 0 ) {
+                H5Pset_scaleoffset( dcr_, H5Z_SO_FLOAT_DSCALE, filespace->scaleoffset_ );
+                filtered = true;
+            }
+            if( filespace->deflate_ > 0 ) {
+                H5Pset_shuffle( dcr_ );
+                H5Pset_deflate( dcr_, std::min( 9, filespace->deflate_ ) );
+                filtered = true;
+            }
         }
         if( H5Lexists( loc->id_, name.c_str(), H5P_DEFAULT ) == 0 ) {
             id_  = H5Dcreate( loc->id_, name.c_str(), type, filespace->sid_, H5P_DEFAULT, dcr_, H5P_DEFAULT );
@@ -151,6 +168,9 @@ public:
             id_ = H5Dopen( loc->id_, name.c_str(), pid );
             H5Pclose( pid );
         }
+        if( filtered ) {
+            H5Premove_filter( dcr_, H5Z_FILTER_ALL );
+        }
         H5Pset_layout( dcr_, layout );
     }
     
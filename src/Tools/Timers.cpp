@@ -28,7 +28,14 @@ Timers::Timers( SmileiMPI *smpi ) :
     envelope( "Envelope" ),
     susceptibility( "Sync_Susceptibility" ),
     grids("Grids"),
-    densitiesCorrection("Dens Correction")
+    densitiesCorrection("Dens Correction"),
+    initTables( "Tables" ),                 // Radiation and pair creation tables
+    initPatches( "Patches" ),               // Patch creation: fields, species and operators
+    initParticles( "Particles" ),           // Profile evaluation and particle creation in cloned patches
+    initRestart( "Restart" ),               // Reading the checkpoint files
+    initSorting( "Sorting" ),               // initialParticleSorting
+    initFields( "Fields" ),                 // Poisson, external fields, antennas, lasers
+    initDiags( "Diagnostics" )              // Creation of diags, files and diags at t=0
 #ifdef __DETAILED_TIMERS
     // Details of Dynamic
     , interpolator( "Interpolator" ),
@@ -110,6 +117,18 @@ Timers::Timers( SmileiMPI *smpi ) :
         timers[i]->init( smpi );
     }
     
+    init_timers.resize( 0 );
+    init_timers.push_back( &initTables );
+    init_timers.push_back( &initPatches );
+    init_timers.push_back( &initParticles );
+    init_timers.push_back( &initRestart );
+    init_timers.push_back( &initSorting );
+    init_timers.push_back( &initFields );
+    init_timers.push_back( &initDiags );
+    for( unsigned int i=0; i<init_timers.size(); i++ ) {
+        init_timers[i]->init( smpi );
+    }
+    
     if( smpi->getRank()==0 && ! smpi->test_mode ) {
         remove( "profil.txt" );
         ofstream fout;
@@ -176,6 +195,34 @@ void Timers::profile( SmileiMPI *smpi )
     }
 }
 
+//! Output the profile of the initialization phases
+void Timers::profileInitialization( SmileiMPI *smpi )
+{
+    unsigned int n = init_timers.size();
+    vector<double> t( n ), tmin( n ), tmax( n ), tsum( n );
+    for( unsigned int i=0 ; i<n ; i++ ) {
+        t[i] = init_timers[i]->getTime();
+    }
+    MPI_Reduce( &t[0], &tmin[0], n, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD );
+    MPI_Reduce( &t[0], &tmax[0], n, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+    MPI_Reduce( &t[0], &tsum[0], n, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+    
+    if( smpi->isMaster() ) {
+        MESSAGE( 1, setw( 20 ) << "Phase" << "\t" << setw( 12 ) << "Min" << "\t" << setw( 12 ) << "Avg" << "\t" << setw( 12 ) << "Max" );
+        for( unsigned int i=0 ; i<n ; i++ ) {
+            if( tmax[i] > 0. ) {
+                MESSAGE( 1, setw( 20 ) << init_timers[i]->name() << scientific << setprecision( 3 )
+                         << "\t" << setw( 12 ) << tmin[i]
+                         << "\t" << setw( 12 ) << tsum[i]/smpi->getSize()
+                         << "\t" << setw( 12 ) << tmax[i] );
+            }
+        }
+        // Restore the default output format
+        cout.setf( ios::fixed,  ios::floatfield );
+        cout.precision( 6 );
+    }
+}
+
 //! Perform the required processing on the timers for output
 std::vector<Timer *> Timers::consolidate( SmileiMPI *smpi, bool final_profile )
 {
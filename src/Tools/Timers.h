@@ -39,6 +39,15 @@ public:
     Timer susceptibility ;
     Timer grids ;
     Timer densitiesCorrection ;
+    
+    // Initialization phases, profiled once before the time loop
+    Timer initTables ;
+    Timer initPatches ;
+    Timer initParticles ;
+    Timer initRestart ;
+    Timer initSorting ;
+    Timer initFields ;
+    Timer initDiags ;
 #ifdef __DETAILED_TIMERS
     Timer interpolator  ;
     Timer pusher  ;
@@ -65,6 +74,9 @@ public:
     //! Output the timer profile
     void profile( SmileiMPI *smpi );
     
+    //! Output the profile of the initialization phases
+    void profileInitialization( SmileiMPI *smpi );
+    
     //! Perform the required processing on the timers for output
     std::vector<Timer *> consolidate( SmileiMPI *smpi, bool final_profile = false );
     
@@ -72,6 +84,7 @@ public:
     
 private:
     std::vector<Timer *> timers;
+    std::vector<Timer *> init_timers;
     
 };
 
@@ -0,0 +1,18 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Dense and sparse outputs must be identical
+for idiag in [0, 1]:
+    dense  = np.array(S.ParticleBinning(idiag  ).getData())
+    sparse = np.array(S.ParticleBinning(idiag+2).getData())
+    Validate("Sparse and dense binnings #"+str(idiag)+" are equal", np.abs(sparse-dense).max() < 1e-10*np.abs(dense).max() )
+
+# Density from the sparse phase space
+density = S.ParticleBinning(2, sum={"px":"all","py":"all"}).getData()
+Validate("Density from sparse phase space", np.array(density), 0.01)
+
+# Kinetic energy from the sparse spectrum
+energy = np.array(S.ParticleBinning(3, sum={"ekin":"all"}).getData())
+Validate("Kinetic energy from sparse spectrum", energy, energy.max()*0.05)
@@ -0,0 +1,15 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Fields at the end of the simulation
+Ey = S.Field.Field0.Ey(timesteps=150).getData()[0]
+Validate("Ey field at the end", Ey, 0.01)
+
+Rho = S.Field.Field0.Rho_electron(timesteps=150).getData()[0]
+Validate("Electron density at the end", Rho, 0.01)
+
+# Energy balance
+Utot = S.Scalar.Utot().getData()
+Validate("Total energy", Utot, 0.001)
@@ -0,0 +1,15 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Electron density after the window moved and the patches were balanced
+Rho = S.ParticleBinning(0, timesteps=200).getData()[0]
+Validate("Electron density at the end", Rho, 1e-8)
+
+# Field and kinetic energies
+Uelm = S.Scalar.Uelm().getData()
+Validate("Field energy", Uelm, 1e-8)
+
+Ukin = S.Scalar.Ukin().getData()
+Validate("Kinetic energy", Ukin, 1e-8)
@@ -0,0 +1,21 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Fields after the two pulses crossed the periodic boundaries
+timesteps = list(S.Field.Field0("Ez").getAvailableTimesteps())
+Validate("List of timesteps in Field0", timesteps )
+
+Ez = S.Field.Field0("Ez", timesteps=timesteps[-1]).getData()[0]
+Validate("Last Ez profile", Ez, 1e-6 )
+By = S.Field.Field0("By", timesteps=timesteps[-1]).getData()[0]
+Validate("Last By profile", By, 1e-6 )
+Ex = S.Field.Field0("Ex", timesteps=timesteps[-1]).getData()[0]
+Validate("Last Ex profile", Ex, 1e-6 )
+
+# Field and kinetic energies
+Uelm = S.Scalar.Uelm().getData()
+Validate("Field energy", Uelm, 1e-6 )
+Ukin = S.Scalar.Ukin().getData()
+Validate("Kinetic energy", Ukin, 1e-6 )
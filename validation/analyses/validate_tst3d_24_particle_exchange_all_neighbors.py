@@ -0,0 +1,17 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Number of particles (some are removed at the z boundaries)
+Ntot = S.Scalar.Ntot_electron().getData()
+Validate("Number of electrons", Ntot, 0.)
+
+# Particle distribution in the x-y plane, crossing all the patch corners
+last = S.ParticleBinning(0).getTimesteps()[-1]
+density = S.ParticleBinning(0, timesteps=last).getData()[0]
+Validate("Electron distribution in x-y", density, 1e-8)
+
+# Energy balance
+Ukin = S.Scalar.Ukin().getData()
+Validate("Kinetic energy", Ukin, 1e-8)